@@ -0,0 +1,330 @@
+#include "cpu65c02.h"
+
+// Base cycles per opcode (W65C02S). Penalties are added in step().
+static const uint8_t base_cycles[256] = {
+//  0  1  2  3  4  5  6  7  8  9  A  B  C  D  E  F
+    7, 6, 2, 1, 5, 3, 5, 5, 3, 2, 2, 1, 6, 4, 6, 5,  // 0x
+    2, 5, 5, 1, 5, 4, 6, 5, 2, 4, 2, 1, 6, 4, 6, 5,  // 1x
+    6, 6, 2, 1, 3, 3, 5, 5, 4, 2, 2, 1, 4, 4, 6, 5,  // 2x
+    2, 5, 5, 1, 4, 4, 6, 5, 2, 4, 2, 1, 4, 4, 6, 5,  // 3x
+    6, 6, 2, 1, 3, 3, 5, 5, 3, 2, 2, 1, 3, 4, 6, 5,  // 4x
+    2, 5, 5, 1, 4, 4, 6, 5, 2, 4, 3, 1, 8, 4, 6, 5,  // 5x
+    6, 6, 2, 1, 3, 3, 5, 5, 4, 2, 2, 1, 6, 4, 6, 5,  // 6x
+    2, 5, 5, 1, 4, 4, 6, 5, 2, 4, 4, 1, 6, 4, 6, 5,  // 7x
+    3, 6, 2, 1, 3, 3, 3, 5, 2, 2, 2, 1, 4, 4, 4, 5,  // 8x
+    2, 6, 5, 1, 4, 4, 4, 5, 2, 5, 2, 1, 4, 5, 5, 5,  // 9x
+    2, 6, 2, 1, 3, 3, 3, 5, 2, 2, 2, 1, 4, 4, 4, 5,  // Ax
+    2, 5, 5, 1, 4, 4, 4, 5, 2, 4, 2, 1, 4, 4, 4, 5,  // Bx
+    2, 6, 2, 1, 3, 3, 5, 5, 2, 2, 2, 3, 4, 4, 6, 5,  // Cx
+    2, 5, 5, 1, 4, 4, 6, 5, 2, 4, 3, 3, 4, 4, 7, 5,  // Dx
+    2, 6, 2, 1, 3, 3, 5, 5, 2, 2, 2, 1, 4, 4, 6, 5,  // Ex
+    2, 5, 5, 1, 4, 4, 6, 5, 2, 4, 4, 1, 4, 4, 7, 5,  // Fx
+};
+
+void Cpu65C02::reset()
+{
+    a = x = y = 0;
+    sp = 0xFD;
+    p = 0x24;
+    pc = read(0xFFFC) | (read(0xFFFD) << 8);
+    stopped = false;
+}
+
+void Cpu65C02::adc(uint8_t v)
+{
+    unsigned c = p & 1;
+    if (p & 0x08) {
+        unsigned lo = (a & 0x0F) + (v & 0x0F) + c;
+        unsigned hi = (a >> 4) + (v >> 4);
+        if (lo > 9) { lo += 6; hi++; }
+        unsigned bin = a + v + c;
+        p = (p & ~0x40) | ((~(a ^ v) & (a ^ bin) & 0x80) ? 0x40 : 0);
+        if (hi > 9) hi += 6;
+        p = (p & ~1) | (hi > 15 ? 1 : 0);
+        a = (uint8_t)((hi << 4) | (lo & 0x0F));
+        set_nz(a);
+        cycles++;
+        return;
+    }
+    unsigned r = a + v + c;
+    p = (p & ~0x41) | (r > 0xFF ? 1 : 0) | ((~(a ^ v) & (a ^ r) & 0x80) ? 0x40 : 0);
+    a = (uint8_t)r;
+    set_nz(a);
+}
+
+void Cpu65C02::sbc(uint8_t v)
+{
+    if (p & 0x08) {
+        int c = p & 1;
+        int lo = (a & 0x0F) - (v & 0x0F) - (1 - c);
+        int hi = (a >> 4) - (v >> 4);
+        if (lo < 0) { lo -= 6; hi--; }
+        if (hi < 0) hi -= 6;
+        unsigned bin = a - v - (1 - c);
+        p = (p & ~0x41) | (bin < 0x100 ? 1 : 0) | (((a ^ v) & (a ^ bin) & 0x80) ? 0x40 : 0);
+        a = (uint8_t)((hi << 4) | (lo & 0x0F));
+        set_nz(a);
+        cycles++;
+        return;
+    }
+    adc(~v);
+}
+
+void Cpu65C02::cmp(uint8_t r, uint8_t v)
+{
+    uint8_t d = r - v;
+    p = (p & ~1) | (r >= v ? 1 : 0);
+    set_nz(d);
+}
+
+void Cpu65C02::branch(bool cond)
+{
+    int8_t off = (int8_t)fetch();
+    if (!cond) return;
+    uint16_t dest = pc + off;
+    cycles += ((dest ^ pc) & 0xFF00) ? 2 : 1;
+    pc = dest;
+}
+
+void Cpu65C02::step()
+{
+    if (stopped) { cycles++; return; }
+
+    uint8_t op = fetch();
+    cycles += base_cycles[op];
+
+    // Effective address helpers. The *_r variants add the page-cross cycle.
+    uint16_t ea = 0;
+    auto zp     = [&]() { ea = fetch(); };
+    auto zpx    = [&]() { ea = (uint8_t)(fetch() + x); };
+    auto zpy    = [&]() { ea = (uint8_t)(fetch() + y); };
+    auto ab     = [&]() { ea = fetch16(); };
+    auto abx    = [&]() { uint16_t b = fetch16(); ea = b + x; };
+    auto aby    = [&]() { uint16_t b = fetch16(); ea = b + y; };
+    auto abx_r  = [&]() { uint16_t b = fetch16(); ea = b + x; if ((b ^ ea) & 0xFF00) cycles++; };
+    auto aby_r  = [&]() { uint16_t b = fetch16(); ea = b + y; if ((b ^ ea) & 0xFF00) cycles++; };
+    auto izx    = [&]() { ea = read16_zp((uint8_t)(fetch() + x)); };
+    auto izy    = [&]() { uint16_t b = read16_zp(fetch()); ea = b + y; };
+    auto izy_r  = [&]() { uint16_t b = read16_zp(fetch()); ea = b + y; if ((b ^ ea) & 0xFF00) cycles++; };
+    auto izp    = [&]() { ea = read16_zp(fetch()); };
+
+    auto asl = [&](uint8_t v) { p = (p & ~1) | (v >> 7); v <<= 1; set_nz(v); return v; };
+    auto lsr = [&](uint8_t v) { p = (p & ~1) | (v & 1); v >>= 1; set_nz(v); return v; };
+    auto rol = [&](uint8_t v) { uint8_t c = p & 1; p = (p & ~1) | (v >> 7); v = (v << 1) | c; set_nz(v); return v; };
+    auto ror = [&](uint8_t v) { uint8_t c = p & 1; p = (p & ~1) | (v & 1); v = (v >> 1) | (c << 7); set_nz(v); return v; };
+    auto bit = [&](uint8_t v) { p = (p & 0x3D) | (v & 0xC0) | ((a & v) ? 0 : 0x02); };
+
+#define RMW(mode, fn) { mode(); write(ea, fn(read(ea))); break; }
+
+    switch (op) {
+    // --- Loads ---
+    case 0xA9: a = fetch(); set_nz(a); break;
+    case 0xA5: zp();    a = read(ea); set_nz(a); break;
+    case 0xB5: zpx();   a = read(ea); set_nz(a); break;
+    case 0xAD: ab();    a = read(ea); set_nz(a); break;
+    case 0xBD: abx_r(); a = read(ea); set_nz(a); break;
+    case 0xB9: aby_r(); a = read(ea); set_nz(a); break;
+    case 0xA1: izx();   a = read(ea); set_nz(a); break;
+    case 0xB1: izy_r(); a = read(ea); set_nz(a); break;
+    case 0xB2: izp();   a = read(ea); set_nz(a); break;
+
+    case 0xA2: x = fetch(); set_nz(x); break;
+    case 0xA6: zp();    x = read(ea); set_nz(x); break;
+    case 0xB6: zpy();   x = read(ea); set_nz(x); break;
+    case 0xAE: ab();    x = read(ea); set_nz(x); break;
+    case 0xBE: aby_r(); x = read(ea); set_nz(x); break;
+
+    case 0xA0: y = fetch(); set_nz(y); break;
+    case 0xA4: zp();    y = read(ea); set_nz(y); break;
+    case 0xB4: zpx();   y = read(ea); set_nz(y); break;
+    case 0xAC: ab();    y = read(ea); set_nz(y); break;
+    case 0xBC: abx_r(); y = read(ea); set_nz(y); break;
+
+    // --- Stores ---
+    case 0x85: zp();  write(ea, a); break;
+    case 0x95: zpx(); write(ea, a); break;
+    case 0x8D: ab();  write(ea, a); break;
+    case 0x9D: abx(); write(ea, a); break;
+    case 0x99: aby(); write(ea, a); break;
+    case 0x81: izx(); write(ea, a); break;
+    case 0x91: izy(); write(ea, a); break;
+    case 0x92: izp(); write(ea, a); break;
+    case 0x86: zp();  write(ea, x); break;
+    case 0x96: zpy(); write(ea, x); break;
+    case 0x8E: ab();  write(ea, x); break;
+    case 0x84: zp();  write(ea, y); break;
+    case 0x94: zpx(); write(ea, y); break;
+    case 0x8C: ab();  write(ea, y); break;
+    case 0x64: zp();  write(ea, 0); break;
+    case 0x74: zpx(); write(ea, 0); break;
+    case 0x9C: ab();  write(ea, 0); break;
+    case 0x9E: abx(); write(ea, 0); break;
+
+    // --- ALU: ORA AND EOR ADC CMP SBC ---
+#define ALU(base, expr) \
+    case base + 0x09: { uint8_t v = fetch(); expr; break; } \
+    case base + 0x05: { zp();    uint8_t v = read(ea); expr; break; } \
+    case base + 0x15: { zpx();   uint8_t v = read(ea); expr; break; } \
+    case base + 0x0D: { ab();    uint8_t v = read(ea); expr; break; } \
+    case base + 0x1D: { abx_r(); uint8_t v = read(ea); expr; break; } \
+    case base + 0x19: { aby_r(); uint8_t v = read(ea); expr; break; } \
+    case base + 0x01: { izx();   uint8_t v = read(ea); expr; break; } \
+    case base + 0x11: { izy_r(); uint8_t v = read(ea); expr; break; } \
+    case base + 0x12: { izp();   uint8_t v = read(ea); expr; break; }
+    ALU(0x00, a |= v; set_nz(a))
+    ALU(0x20, a &= v; set_nz(a))
+    ALU(0x40, a ^= v; set_nz(a))
+    ALU(0x60, adc(v))
+    ALU(0xC0, cmp(a, v))
+    ALU(0xE0, sbc(v))
+#undef ALU
+
+    case 0xE0: cmp(x, fetch()); break;
+    case 0xE4: zp(); cmp(x, read(ea)); break;
+    case 0xEC: ab(); cmp(x, read(ea)); break;
+    case 0xC0: cmp(y, fetch()); break;
+    case 0xC4: zp(); cmp(y, read(ea)); break;
+    case 0xCC: ab(); cmp(y, read(ea)); break;
+
+    case 0x89: p = (p & ~0x02) | ((a & fetch()) ? 0 : 0x02); break;  // BIT #imm only sets Z
+    case 0x24: zp();    bit(read(ea)); break;
+    case 0x34: zpx();   bit(read(ea)); break;
+    case 0x2C: ab();    bit(read(ea)); break;
+    case 0x3C: abx_r(); bit(read(ea)); break;
+
+    // --- Shifts / INC / DEC ---
+    case 0x0A: a = asl(a); break;
+    case 0x4A: a = lsr(a); break;
+    case 0x2A: a = rol(a); break;
+    case 0x6A: a = ror(a); break;
+    case 0x06: RMW(zp, asl)
+    case 0x16: RMW(zpx, asl)
+    case 0x0E: RMW(ab, asl)
+    case 0x1E: RMW(abx_r, asl)
+    case 0x46: RMW(zp, lsr)
+    case 0x56: RMW(zpx, lsr)
+    case 0x4E: RMW(ab, lsr)
+    case 0x5E: RMW(abx_r, lsr)
+    case 0x26: RMW(zp, rol)
+    case 0x36: RMW(zpx, rol)
+    case 0x2E: RMW(ab, rol)
+    case 0x3E: RMW(abx_r, rol)
+    case 0x66: RMW(zp, ror)
+    case 0x76: RMW(zpx, ror)
+    case 0x6E: RMW(ab, ror)
+    case 0x7E: RMW(abx_r, ror)
+
+    case 0x1A: a++; set_nz(a); break;
+    case 0x3A: a--; set_nz(a); break;
+    case 0xE8: x++; set_nz(x); break;
+    case 0xCA: x--; set_nz(x); break;
+    case 0xC8: y++; set_nz(y); break;
+    case 0x88: y--; set_nz(y); break;
+    case 0xE6: { zp();  uint8_t v = read(ea) + 1; write(ea, v); set_nz(v); break; }
+    case 0xF6: { zpx(); uint8_t v = read(ea) + 1; write(ea, v); set_nz(v); break; }
+    case 0xEE: { ab();  uint8_t v = read(ea) + 1; write(ea, v); set_nz(v); break; }
+    case 0xFE: { abx(); uint8_t v = read(ea) + 1; write(ea, v); set_nz(v); break; }
+    case 0xC6: { zp();  uint8_t v = read(ea) - 1; write(ea, v); set_nz(v); break; }
+    case 0xD6: { zpx(); uint8_t v = read(ea) - 1; write(ea, v); set_nz(v); break; }
+    case 0xCE: { ab();  uint8_t v = read(ea) - 1; write(ea, v); set_nz(v); break; }
+    case 0xDE: { abx(); uint8_t v = read(ea) - 1; write(ea, v); set_nz(v); break; }
+
+    // TSB / TRB
+    case 0x04: { zp(); uint8_t v = read(ea); p = (p & ~0x02) | ((a & v) ? 0 : 0x02); write(ea, v | a); break; }
+    case 0x0C: { ab(); uint8_t v = read(ea); p = (p & ~0x02) | ((a & v) ? 0 : 0x02); write(ea, v | a); break; }
+    case 0x14: { zp(); uint8_t v = read(ea); p = (p & ~0x02) | ((a & v) ? 0 : 0x02); write(ea, v & ~a); break; }
+    case 0x1C: { ab(); uint8_t v = read(ea); p = (p & ~0x02) | ((a & v) ? 0 : 0x02); write(ea, v & ~a); break; }
+
+    // --- Transfers / stack / flags ---
+    case 0xAA: x = a; set_nz(x); break;
+    case 0xA8: y = a; set_nz(y); break;
+    case 0x8A: a = x; set_nz(a); break;
+    case 0x98: a = y; set_nz(a); break;
+    case 0xBA: x = sp; set_nz(x); break;
+    case 0x9A: sp = x; break;
+    case 0x48: push(a); break;
+    case 0xDA: push(x); break;
+    case 0x5A: push(y); break;
+    case 0x08: push(p | 0x30); break;
+    case 0x68: a = pull(); set_nz(a); break;
+    case 0xFA: x = pull(); set_nz(x); break;
+    case 0x7A: y = pull(); set_nz(y); break;
+    case 0x28: p = pull() | 0x20; break;
+    case 0x18: p &= ~0x01; break;
+    case 0x38: p |= 0x01; break;
+    case 0x58: p &= ~0x04; break;
+    case 0x78: p |= 0x04; break;
+    case 0xB8: p &= ~0x40; break;
+    case 0xD8: p &= ~0x08; break;
+    case 0xF8: p |= 0x08; break;
+
+    // --- Flow ---
+    case 0x10: branch(!(p & 0x80)); break;
+    case 0x30: branch(p & 0x80); break;
+    case 0x50: branch(!(p & 0x40)); break;
+    case 0x70: branch(p & 0x40); break;
+    case 0x90: branch(!(p & 0x01)); break;
+    case 0xB0: branch(p & 0x01); break;
+    case 0xD0: branch(!(p & 0x02)); break;
+    case 0xF0: branch(p & 0x02); break;
+    case 0x80: { int8_t off = (int8_t)fetch(); uint16_t d = pc + off; if ((d ^ pc) & 0xFF00) cycles++; pc = d; break; }
+
+    case 0x4C: pc = fetch16(); break;
+    case 0x6C: { uint16_t i = fetch16(); pc = read(i) | (read(i + 1) << 8); break; }
+    case 0x7C: { uint16_t i = fetch16() + x; pc = read(i) | (read(i + 1) << 8); break; }
+    case 0x20: {
+        uint16_t t = fetch16();
+        uint16_t r = pc - 1;
+        push(r >> 8);
+        push(r & 0xFF);
+        pc = t;
+        if (on_jsr) on_jsr(ctx, t);
+        break;
+    }
+    case 0x60: {
+        uint16_t r = pull();
+        r |= pull() << 8;
+        pc = r + 1;
+        if (on_rts) on_rts(ctx);
+        break;
+    }
+    case 0x40: { p = pull() | 0x20; uint16_t r = pull(); r |= pull() << 8; pc = r; break; }
+    case 0x00: {
+        uint16_t r = pc + 1;
+        push(r >> 8);
+        push(r & 0xFF);
+        push(p | 0x30);
+        p = (p | 0x04) & ~0x08;
+        pc = read(0xFFFE) | (read(0xFFFF) << 8);
+        break;
+    }
+
+    case 0xDB: stopped = true; pc--; break;     // STP
+    case 0xCB: break;                           // WAI: no interrupts modelled
+    case 0xEA: break;
+
+    // Reserved NOPs with operands
+    case 0x02: case 0x22: case 0x42: case 0x62: case 0x82: case 0xC2: case 0xE2:
+    case 0x44: case 0x54: case 0xD4: case 0xF4:
+        pc++; break;
+    case 0x5C: case 0xDC: case 0xFC:
+        pc += 2; break;
+
+    default:
+        // RMBn / SMBn / BBRn / BBSn
+        if ((op & 0x0F) == 0x07) {
+            zp();
+            uint8_t m = 1 << ((op >> 4) & 7);
+            uint8_t v = read(ea);
+            write(ea, (op & 0x80) ? (v | m) : (v & ~m));
+        } else if ((op & 0x0F) == 0x0F) {
+            zp();
+            uint8_t m = 1 << ((op >> 4) & 7);
+            bool set = read(ea) & m;
+            branch((op & 0x80) ? set : !set);
+        }
+        // Remaining xxxx0011 / xxxx1011 are 1-cycle NOPs
+        break;
+    }
+#undef RMW
+}
@@ -0,0 +1,66 @@
+#ifndef CPU65C02_H
+#define CPU65C02_H
+
+#include <stdint.h>
+
+// ============================================================================
+// W65C02S CORE (for the cycle benchmark)
+// ============================================================================
+// Small interpreter for the CPU the llvm-mos rp6502 target generates code
+// for, including the WDC bit instructions (RMB/SMB/BBR/BBS). Cycle counts
+// follow the WDC datasheet: page-cross penalties on indexed reads, +1/+2
+// on taken branches, +1 for decimal ADC/SBC.
+//
+// RAM below io_base is read and written directly; everything from io_base
+// up goes through the io_read/io_write hooks so the RIA and VIA can be
+// stood in for.
+
+class Cpu65C02 {
+public:
+    uint8_t a = 0, x = 0, y = 0, sp = 0xFD, p = 0x24;
+    uint16_t pc = 0;
+    uint64_t cycles = 0;
+    bool stopped = false;       // STP executed
+
+    uint8_t ram[0x10000] = {};
+    uint16_t io_base = 0xFFD0;
+
+    // Called on every JSR and RTS so the harness can keep a call stack
+    void (*on_jsr)(void *ctx, uint16_t target) = nullptr;
+    void (*on_rts)(void *ctx) = nullptr;
+    uint8_t (*io_read)(void *ctx, uint16_t addr) = nullptr;
+    void (*io_write)(void *ctx, uint16_t addr, uint8_t val) = nullptr;
+    void *ctx = nullptr;
+
+    void reset();
+    void step();
+
+    uint8_t read(uint16_t addr)
+    {
+        if (addr >= io_base && io_read) return io_read(ctx, addr);
+        return ram[addr];
+    }
+
+    void write(uint16_t addr, uint8_t val)
+    {
+        if (addr >= io_base && io_write) { io_write(ctx, addr, val); return; }
+        ram[addr] = val;
+    }
+
+private:
+    uint8_t fetch() { return read(pc++); }
+    uint16_t fetch16() { uint16_t lo = fetch(); return lo | (fetch() << 8); }
+    uint16_t read16_zp(uint8_t zp) { return ram[zp] | (ram[(uint8_t)(zp + 1)] << 8); }
+
+    void push(uint8_t v) { ram[0x100 | sp--] = v; }
+    uint8_t pull() { return ram[0x100 | ++sp]; }
+
+    void set_nz(uint8_t v) { p = (p & 0x7D) | (v & 0x80) | (v ? 0 : 0x02); }
+
+    void adc(uint8_t v);
+    void sbc(uint8_t v);
+    void cmp(uint8_t r, uint8_t v);
+    void branch(bool cond);
+};
+
+#endif // CPU65C02_H
@@ -0,0 +1,101 @@
+#ifndef _RP6502_H
+#define _RP6502_H
+
+// ============================================================================
+// HOST STUB OF rp6502.h
+// ============================================================================
+// Lets the unmodified game sources build and run natively on Linux (see
+// host/CMakeLists.txt). The sources are compiled as C++ only so that the
+// RIA registers can be small proxy objects: writing RIA.rw0 stores into a
+// 64KB XRAM array and steps addr0, exactly like the real RIA, and every
+// access is counted. Only the parts of the real header the game uses are
+// provided here.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+extern uint8_t ria_host_xram[0x10000];
+
+// Access hooks, implemented in host/ria_host.cpp
+extern uint8_t ria_host_read_rw0(void);
+extern void ria_host_write_rw0(uint8_t val);
+extern uint8_t ria_host_read_vsync(void);
+extern void ria_host_touch(void);
+extern uint16_t ria_host_clock(void);
+extern void ria_host_struct_set(uint16_t addr, size_t size, long val);
+
+struct __ria_rw {
+    operator uint8_t() const { return ria_host_read_rw0(); }
+    __ria_rw &operator=(uint8_t v) { ria_host_write_rw0(v); return *this; }
+};
+
+struct __ria_vsync {
+    operator uint8_t() const { return ria_host_read_vsync(); }
+};
+
+// Plain register: stored as-is, but any access ends a vsync spin
+template <typename T> struct __ria_reg {
+    T v;
+    operator T() const { ria_host_touch(); return v; }
+    __ria_reg &operator=(T nv) { ria_host_touch(); v = nv; return *this; }
+};
+
+struct __RP6502 {
+    __ria_vsync vsync;
+    __ria_rw rw0;
+    __ria_reg<int8_t> step0;
+    __ria_reg<uint16_t> addr0;
+    __ria_rw rw1;               // Not modelled beyond rw0
+    __ria_reg<int8_t> step1;
+    __ria_reg<uint16_t> addr1;
+};
+extern struct __RP6502 RIA;
+
+struct __VIA6522 {
+    uint8_t prb, pra, ddrb, ddra;
+    uint8_t t1_lo, t1_hi, t1l_lo, t1l_hi;
+    uint8_t t2_lo, t2_hi, sr, acr, pcr, ifr, ier, pra2;
+};
+extern struct __VIA6522 VIA;
+
+// VGA config structs, same layout as the firmware (little endian, packed)
+typedef struct {
+    int16_t x_pos_px;
+    int16_t y_pos_px;
+    uint16_t xram_sprite_ptr;
+    uint8_t log_size;
+    bool has_opacity_metadata;
+} vga_mode4_sprite_t;
+
+typedef struct {
+    bool x_wrap;
+    bool y_wrap;
+    int16_t x_pos_px;
+    int16_t y_pos_px;
+    int16_t width_tiles;
+    int16_t height_tiles;
+    uint16_t xram_data_ptr;
+    uint16_t xram_palette_ptr;
+    uint16_t xram_tile_ptr;
+} vga_mode2_config_t;
+
+typedef struct {
+    bool x_wrap;
+    bool y_wrap;
+    int16_t x_pos_px;
+    int16_t y_pos_px;
+    int16_t width_chars;
+    int16_t height_chars;
+    uint16_t xram_data_ptr;
+    uint16_t xram_palette_ptr;
+    uint16_t xram_font_ptr;
+} vga_mode1_config_t;
+
+#define xram0_struct_set(addr, type, member, val) \
+    ria_host_struct_set((addr) + offsetof(type, member), \
+                        sizeof(((type *)0)->member), (long)(val))
+
+extern int xregn(char device, char channel, unsigned char address, unsigned count, ...);
+
+#endif // _RP6502_H
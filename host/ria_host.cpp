@@ -0,0 +1,236 @@
+// ============================================================================
+// HOST RIA / XRAM STUB
+// ============================================================================
+// Backs host/include/rp6502.h. Models a 64KB XRAM, RIA.addr0/step0/rw0,
+// xregn and RIA.vsync, injects keyboard input from a script and counts XRAM
+// traffic so the game loop can be benchmarked and soak tested on Linux.
+//
+// Environment:
+//   RPMC_FRAMES=<n>     stop after n frames (default 3600, 0 = run forever)
+//   RPMC_INPUT=<file>   keyboard script, one "<frame> <key> <key>..." per
+//                       line (HID codes, e.g. 0x28). Keys are held until the
+//                       next line. '#' starts a comment.
+//
+// With no script the game sits on the title screen and drops into demo mode,
+// which is enough for a soak test.
+
+#include <rp6502.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <time.h>
+#include "constants.h"
+
+uint8_t ria_host_xram[0x10000];
+struct __RP6502 RIA;
+struct __VIA6522 VIA;
+
+// --- Frame pacing ---
+// The game spins on "if (RIA.vsync == vsync_last) continue;". We call it the
+// next vblank once vsync has been read three times with no other RIA access
+// in between, i.e. the loop is idle. That gives exactly one frame per pass.
+static uint8_t vsync_streak = 0;
+static uint8_t vsync_count = 0;
+static unsigned long frame = 0;
+static unsigned long frame_limit = 3600;
+
+// --- XRAM traffic ---
+typedef struct {
+    uint16_t addr;
+    uint16_t size;
+    const char *label;
+    unsigned long writes;
+} HostRegion;
+
+#define HOST_REGION(a, s, l) { (uint16_t)(a), (uint16_t)(s), l, 0 },
+static HostRegion regions[] = {
+    XRAM_LAYOUT_REGIONS(HOST_REGION)
+};
+#undef HOST_REGION
+#define NUM_REGIONS (sizeof(regions) / sizeof(regions[0]))
+#define REGION_NONE 0xFF
+
+static uint8_t region_of[0x10000];
+static unsigned long xram_writes = 0;
+static unsigned long xram_reads = 0;
+static unsigned long xregn_calls = 0;
+static unsigned long frame_writes_start = 0;
+static unsigned long frame_writes_max = 0;
+static unsigned long frame_writes_max_at = 0;
+static uint16_t clock_ops = 0;
+
+static struct timespec started;
+
+// --- Input script ---
+typedef struct {
+    unsigned long frame;
+    uint8_t keys[KEYBOARD_BYTES];
+} InputStep;
+
+static InputStep *script = NULL;
+static size_t script_len = 0;
+static size_t script_pos = 0;
+
+static void load_script(const char *path)
+{
+    FILE *fp = fopen(path, "r");
+    if (!fp) {
+        fprintf(stderr, "ria_host: can't open input script %s\n", path);
+        exit(1);
+    }
+
+    char line[256];
+    while (fgets(line, sizeof(line), fp)) {
+        char *hash = strchr(line, '#');
+        if (hash) *hash = '\0';
+
+        char *p = line;
+        char *end;
+        unsigned long f = strtoul(p, &end, 0);
+        if (end == p) continue;     // Blank / comment line
+
+        script = (InputStep *)realloc(script, (script_len + 1) * sizeof(InputStep));
+        InputStep *step = &script[script_len++];
+        memset(step, 0, sizeof(*step));
+        step->frame = f;
+
+        for (p = end;;) {
+            unsigned long code = strtoul(p, &end, 0);
+            if (end == p) break;
+            step->keys[(code >> 3) & (KEYBOARD_BYTES - 1)] |= 1 << (code & 7);
+            p = end;
+        }
+    }
+    fclose(fp);
+}
+
+static void apply_input(void)
+{
+    while (script_pos < script_len && script[script_pos].frame <= frame) {
+        memcpy(&ria_host_xram[KEYBOARD_INPUT], script[script_pos].keys, KEYBOARD_BYTES);
+        script_pos++;
+    }
+}
+
+static void report(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    double secs = (now.tv_sec - started.tv_sec) + (now.tv_nsec - started.tv_nsec) / 1e9;
+    unsigned long frames = frame ? frame : 1;
+
+    fprintf(stderr, "\n=== ria_host: %lu frames in %.2fs (%.0f fps) ===\n",
+            frame, secs, secs > 0 ? frame / secs : 0.0);
+    fprintf(stderr, "XRAM writes: %lu total, %.1f/frame, max %lu (frame %lu)\n",
+            xram_writes, (double)xram_writes / frames, frame_writes_max, frame_writes_max_at);
+    fprintf(stderr, "XRAM reads:  %lu total, xregn calls: %lu\n", xram_reads, xregn_calls);
+    fprintf(stderr, "Writes per region:\n");
+    for (size_t i = 0; i < NUM_REGIONS; i++) {
+        if (!regions[i].writes) continue;
+        fprintf(stderr, "  %-22s %10lu  %8.1f/frame\n", regions[i].label,
+                regions[i].writes, (double)regions[i].writes / frames);
+    }
+}
+
+static void host_init(void)
+{
+    static bool done = false;
+    if (done) return;
+    done = true;
+
+    memset(region_of, REGION_NONE, sizeof(region_of));
+    for (size_t i = 0; i < NUM_REGIONS; i++) {
+        for (uint32_t a = regions[i].addr; a < (uint32_t)regions[i].addr + regions[i].size; a++) {
+            region_of[a] = (uint8_t)i;
+        }
+    }
+
+    const char *env = getenv("RPMC_FRAMES");
+    if (env) frame_limit = strtoul(env, NULL, 0);
+    env = getenv("RPMC_INPUT");
+    if (env) load_script(env);
+    apply_input();
+
+    clock_gettime(CLOCK_MONOTONIC, &started);
+    atexit(report);
+}
+
+static void next_frame(void)
+{
+    unsigned long n = xram_writes - frame_writes_start;
+    if (n > frame_writes_max) {
+        frame_writes_max = n;
+        frame_writes_max_at = frame;
+    }
+    frame_writes_start = xram_writes;
+
+    frame++;
+    vsync_count++;
+    if (frame_limit && frame >= frame_limit) exit(0);
+    apply_input();
+}
+
+static void xram_write(uint16_t addr, uint8_t val)
+{
+    ria_host_xram[addr] = val;
+    xram_writes++;
+    clock_ops++;
+    if (region_of[addr] != REGION_NONE) regions[region_of[addr]].writes++;
+}
+
+void ria_host_touch(void)
+{
+    host_init();
+    vsync_streak = 0;
+}
+
+uint8_t ria_host_read_rw0(void)
+{
+    ria_host_touch();
+    uint16_t a = RIA.addr0.v;
+    RIA.addr0.v = a + RIA.step0.v;
+    xram_reads++;
+    clock_ops++;
+    return ria_host_xram[a];
+}
+
+void ria_host_write_rw0(uint8_t val)
+{
+    ria_host_touch();
+    uint16_t a = RIA.addr0.v;
+    RIA.addr0.v = a + RIA.step0.v;
+    xram_write(a, val);
+}
+
+uint8_t ria_host_read_vsync(void)
+{
+    host_init();
+    if (++vsync_streak >= 3) {
+        vsync_streak = 0;
+        next_frame();
+    }
+    return vsync_count;
+}
+
+// XRAM operations so far, for PROFILE_CLOCK in host builds
+uint16_t ria_host_clock(void)
+{
+    return clock_ops;
+}
+
+void ria_host_struct_set(uint16_t addr, size_t size, long val)
+{
+    ria_host_touch();
+    for (size_t i = 0; i < size; i++) {
+        xram_write(addr + i, (uint8_t)(val >> (8 * i)));
+    }
+}
+
+int xregn(char device, char channel, unsigned char address, unsigned count, ...)
+{
+    (void)device; (void)channel; (void)address; (void)count;
+    ria_host_touch();
+    xregn_calls++;
+    return 0;
+}
@@ -0,0 +1,507 @@
+// ============================================================================
+// RP6502 CYCLE BENCHMARK
+// ============================================================================
+// Runs the real llvm-mos build of the game (the .rp6502 ROM) on a W65C02S
+// interpreter with an RIA/XRAM stand-in, plays a keyboard script and counts
+// 6502 cycles per frame and per function (from the linker map).
+//
+//   rp6502_bench build/RPMegaChopper.rp6502 --map build/RPMegaChopper.map
+//                [--script host/scripts/sortie.txt] [--frames 3600]
+//                [--phi2 8000] [--allow 0] [--warmup 2] [--all] [--quiet]
+//
+// A frame's cost is the number of cycles from the vsync tick until the main
+// loop starts spinning on RIA.vsync again. Any frame over the budget
+// (PHI2 / 60) is an overrun; more than --allow overruns exits with status 1
+// so a scenario can gate a change before it goes near hardware.
+//
+// Per-function numbers are inclusive (callees included) and only cover
+// functions that are really called with JSR; anything the compiler inlined
+// is charged to its caller.
+//
+// The stand-in covers what the game and the llvm-mos runtime touch: XRAM
+// through rw0/step0/addr0, the xstack, the op/spin handshake (open fails,
+// so high scores and joystick config fall back to defaults), RIA.tx for
+// printf, RIA.vsync, and VIA timer 1 counting PHI2 for profile builds.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <ctype.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "cpu65c02.h"
+#include "constants.h"
+
+// --- RIA register addresses ---
+#define RIA_READY   0xFFE0
+#define RIA_TX      0xFFE1
+#define RIA_RX      0xFFE2
+#define RIA_VSYNC   0xFFE3
+#define RIA_RW0     0xFFE4
+#define RIA_STEP0   0xFFE5
+#define RIA_ADDR0   0xFFE6
+#define RIA_RW1     0xFFE8
+#define RIA_STEP1   0xFFE9
+#define RIA_ADDR1   0xFFEA
+#define RIA_XSTACK  0xFFEC
+#define RIA_ERRNO   0xFFED
+#define RIA_OP      0xFFEF
+#define RIA_SPIN    0xFFF1
+#define RIA_A       0xFFF4
+#define RIA_X       0xFFF6
+#define RIA_SREG    0xFFF8
+
+#define VIA_T1LO    0xFFD4
+#define VIA_T1HI    0xFFD5
+
+#define RIA_OP_ZXSTACK      0x00
+#define RIA_OP_XREG         0x01
+#define RIA_OP_PHI2         0x02
+#define RIA_OP_LRAND        0x04
+#define RIA_OP_OPEN         0x14
+#define RIA_OP_CLOSE        0x15
+#define RIA_OP_WRITE_XSTACK 0x18
+#define RIA_OP_EXIT         0xFF
+
+#define XSTACK_SIZE 512
+
+struct Symbol {
+    uint16_t addr;
+    std::string name;
+    uint64_t calls = 0;
+    uint64_t total = 0;         // Inclusive cycles over measured frames
+    uint64_t frame_acc = 0;     // Inclusive cycles in the current frame
+    uint64_t frame_max = 0;
+    uint32_t depth = 0;         // Live activations (skip recursion)
+};
+
+struct CallFrame {
+    int sym;
+    uint64_t start;
+};
+
+struct InputStep {
+    unsigned long frame;
+    uint8_t keys[KEYBOARD_BYTES];
+};
+
+struct Bench {
+    Cpu65C02 cpu;
+    uint8_t xram[0x10000] = {};
+    uint8_t xstack[XSTACK_SIZE];
+    unsigned xstack_ptr = XSTACK_SIZE;
+    uint16_t addr0 = 0, addr1 = 0;
+    int8_t step0 = 1, step1 = 1;
+    bool quiet = false;
+    bool exited = false;
+    int exit_code = 0;
+
+    // Timing
+    unsigned phi2_khz = 8000;
+    uint64_t budget = 0;            // Cycles per vsync
+    unsigned long frame_limit = 3600;
+    unsigned long warmup = 2;
+
+    // vsync / frame tracking
+    bool prev_vsync_valid = false;
+    uint16_t prev_vsync_pc = 0;
+    uint8_t prev_vsync_val = 0xFF;
+    uint64_t prev_vsync_cycle = 0;
+    bool loop_pc_known[0x10000] = {};
+    uint8_t loop_pc_val[0x10000] = {};
+    bool frame_open = false;
+    uint64_t frame_start = 0;
+    unsigned long frames_measured = 0;
+    unsigned long frame_index = 0;
+    uint64_t busy_total = 0;
+    uint64_t busy_max = 0;
+    unsigned long busy_max_frame = 0;
+    unsigned long overruns = 0;
+
+    // Symbols
+    std::vector<Symbol> syms;
+    std::unordered_map<uint16_t, int> sym_at;
+    std::vector<CallFrame> calls;
+
+    // Input
+    std::vector<InputStep> script;
+    size_t script_pos = 0;
+    unsigned long last_tick = 0;
+
+    unsigned long tick() const { return (unsigned long)(cpu.cycles / budget); }
+
+    void apply_input()
+    {
+        unsigned long t = tick();
+        while (script_pos < script.size() && script[script_pos].frame <= t) {
+            memcpy(&xram[KEYBOARD_INPUT], script[script_pos].keys, KEYBOARD_BYTES);
+            script_pos++;
+        }
+        if (frame_limit && t >= frame_limit) exited = true;
+    }
+
+    void close_frame(uint64_t end)
+    {
+        uint64_t busy = end - frame_start;
+        frame_open = false;
+        frame_index++;
+
+        if (frame_index <= warmup) {
+            for (Symbol &s : syms) s.frame_acc = 0;
+            return;
+        }
+
+        frames_measured++;
+        busy_total += busy;
+        if (busy > busy_max) {
+            busy_max = busy;
+            busy_max_frame = frame_index;
+        }
+        if (busy > budget) overruns++;
+
+        for (Symbol &s : syms) {
+            if (s.frame_acc > s.frame_max) s.frame_max = s.frame_acc;
+            s.total += s.frame_acc;
+            s.frame_acc = 0;
+        }
+    }
+
+    uint8_t read_vsync()
+    {
+        uint16_t pc = cpu.pc;
+        uint8_t v = (uint8_t)tick();
+
+        if (loop_pc_known[pc] && v != loop_pc_val[pc]) {
+            // The loop saw a new vsync: a frame starts. If the last one never
+            // got back to spinning it ran past the budget and ends here.
+            if (frame_open) close_frame(cpu.cycles);
+            frame_open = true;
+            frame_start = cpu.cycles;
+        } else if (prev_vsync_valid && pc == prev_vsync_pc && v == prev_vsync_val) {
+            // Spinning: the frame's work ended at the first of these reads.
+            loop_pc_known[pc] = true;
+            if (frame_open) close_frame(prev_vsync_cycle);
+            // Skip the idle time straight to the next tick. This read now
+            // returns the new vsync, so the loop goes on to the next frame.
+            cpu.cycles = (tick() + 1) * budget;
+            v = (uint8_t)tick();
+            frame_open = true;
+            frame_start = cpu.cycles;
+        }
+
+        // A read that starts a frame can't be the first half of a spin
+        loop_pc_val[pc] = v;
+        prev_vsync_valid = !(frame_open && frame_start == cpu.cycles);
+        prev_vsync_pc = pc;
+        prev_vsync_val = v;
+        prev_vsync_cycle = cpu.cycles;
+
+        if (tick() != last_tick) {
+            last_tick = tick();
+            apply_input();
+        }
+        return v;
+    }
+
+    uint8_t xstack_pop() { return xstack_ptr < XSTACK_SIZE ? xstack[xstack_ptr++] : 0; }
+
+    void op_return(int16_t ax)
+    {
+        cpu.ram[RIA_A] = ax & 0xFF;
+        cpu.ram[RIA_X] = (ax >> 8) & 0xFF;
+        cpu.ram[RIA_SREG] = cpu.ram[RIA_SREG + 1] = (ax < 0) ? 0xFF : 0x00;
+    }
+
+    void run_op(uint8_t op)
+    {
+        switch (op) {
+        case RIA_OP_EXIT:
+            exited = true;
+            exit_code = cpu.ram[RIA_A];
+            break;
+        case RIA_OP_PHI2:
+            op_return((int16_t)phi2_khz);
+            break;
+        case RIA_OP_LRAND:
+            op_return((int16_t)(rand() & 0x7FFF));
+            break;
+        case RIA_OP_OPEN:
+            // No storage: every open fails, callers use their defaults
+            op_return(-1);
+            break;
+        case RIA_OP_WRITE_XSTACK: {
+            int n = 0;
+            while (xstack_ptr < XSTACK_SIZE) {
+                int c = xstack_pop();
+                if (!quiet) putchar(c);
+                n++;
+            }
+            op_return(n);
+            break;
+        }
+        case RIA_OP_XREG:
+        case RIA_OP_ZXSTACK:
+        case RIA_OP_CLOSE:
+        default:
+            op_return(0);
+            break;
+        }
+        xstack_ptr = XSTACK_SIZE;
+    }
+
+    static uint8_t io_read(void *ctx, uint16_t addr)
+    {
+        Bench *b = (Bench *)ctx;
+        switch (addr) {
+        case VIA_T1LO: return (uint8_t)~b->cpu.cycles;
+        case VIA_T1HI: return (uint8_t)(~b->cpu.cycles >> 8);
+        case RIA_READY: return 0x80;            // TX ready, nothing to read
+        case RIA_RX: return 0;
+        case RIA_VSYNC: return b->read_vsync();
+        case RIA_RW0: {
+            uint8_t v = b->xram[b->addr0];
+            b->addr0 += b->step0;
+            return v;
+        }
+        case RIA_STEP0: return (uint8_t)b->step0;
+        case RIA_ADDR0: return b->addr0 & 0xFF;
+        case RIA_ADDR0 + 1: return b->addr0 >> 8;
+        case RIA_RW1: {
+            uint8_t v = b->xram[b->addr1];
+            b->addr1 += b->step1;
+            return v;
+        }
+        case RIA_STEP1: return (uint8_t)b->step1;
+        case RIA_ADDR1: return b->addr1 & 0xFF;
+        case RIA_ADDR1 + 1: return b->addr1 >> 8;
+        case RIA_XSTACK: return b->xstack_pop();
+        }
+        return b->cpu.ram[addr];
+    }
+
+    static void io_write(void *ctx, uint16_t addr, uint8_t val)
+    {
+        Bench *b = (Bench *)ctx;
+        switch (addr) {
+        case RIA_TX: if (!b->quiet) putchar(val); return;
+        case RIA_RW0: b->xram[b->addr0] = val; b->addr0 += b->step0; return;
+        case RIA_STEP0: b->step0 = (int8_t)val; return;
+        case RIA_ADDR0: b->addr0 = (b->addr0 & 0xFF00) | val; return;
+        case RIA_ADDR0 + 1: b->addr0 = (b->addr0 & 0x00FF) | (val << 8); return;
+        case RIA_RW1: b->xram[b->addr1] = val; b->addr1 += b->step1; return;
+        case RIA_STEP1: b->step1 = (int8_t)val; return;
+        case RIA_ADDR1: b->addr1 = (b->addr1 & 0xFF00) | val; return;
+        case RIA_ADDR1 + 1: b->addr1 = (b->addr1 & 0x00FF) | (val << 8); return;
+        case RIA_XSTACK:
+            if (b->xstack_ptr) b->xstack[--b->xstack_ptr] = val;
+            return;
+        case RIA_OP: b->run_op(val); return;
+        }
+        b->cpu.ram[addr] = val;
+    }
+
+    static void on_jsr(void *ctx, uint16_t target)
+    {
+        Bench *b = (Bench *)ctx;
+        auto it = b->sym_at.find(target);
+        int s = (it == b->sym_at.end()) ? -1 : it->second;
+        if (s >= 0) {
+            b->syms[s].calls += b->frame_open ? 1 : 0;
+            b->syms[s].depth++;
+        }
+        b->calls.push_back({ s, b->cpu.cycles });
+    }
+
+    static void on_rts(void *ctx)
+    {
+        Bench *b = (Bench *)ctx;
+        if (b->calls.empty()) return;
+        CallFrame f = b->calls.back();
+        b->calls.pop_back();
+        if (f.sym < 0) return;
+        Symbol &s = b->syms[f.sym];
+        if (--s.depth == 0) s.frame_acc += b->cpu.cycles - f.start;
+    }
+};
+
+static bool load_rom(Bench &b, const char *path)
+{
+    FILE *fp = fopen(path, "rb");
+    if (!fp) return false;
+
+    char line[256];
+    if (!fgets(line, sizeof(line), fp) || strncasecmp(line, "#!RP6502", 8) != 0) {
+        fclose(fp);
+        return false;
+    }
+    while (fgets(line, sizeof(line), fp)) {
+        char *p = line;
+        while (*p == ' ') p++;
+        if (*p == '#') continue;            // Help text
+        unsigned long addr, len, crc;
+        if (sscanf(p, "$%lx $%lx $%lx", &addr, &len, &crc) != 3) break;
+        uint8_t *dst = (addr < 0x10000) ? &b.cpu.ram[addr] : &b.xram[addr - 0x10000];
+        if (fread(dst, 1, len, fp) != len) break;
+    }
+    fclose(fp);
+    return true;
+}
+
+// ld.lld -Map output: symbol rows are "VMA LMA Size Align name"
+static void load_map(Bench &b, const char *path)
+{
+    FILE *fp = fopen(path, "r");
+    if (!fp) {
+        fprintf(stderr, "rp6502_bench: can't open map %s\n", path);
+        exit(2);
+    }
+    char line[512];
+    while (fgets(line, sizeof(line), fp)) {
+        unsigned long vma, lma, size, align;
+        char name[256];
+        if (sscanf(line, "%lx %lx %lx %lx %255s", &vma, &lma, &size, &align, name) != 5) continue;
+        if (!isalpha((unsigned char)name[0]) && name[0] != '_') continue;
+        if (strchr(name, ':') || strchr(name, '(')) continue;
+        if (vma > 0xFFFF || b.sym_at.count((uint16_t)vma)) continue;
+        Symbol s;
+        s.addr = (uint16_t)vma;
+        s.name = name;
+        b.sym_at[s.addr] = (int)b.syms.size();
+        b.syms.push_back(s);
+    }
+    fclose(fp);
+}
+
+static void load_script(Bench &b, const char *path)
+{
+    FILE *fp = fopen(path, "r");
+    if (!fp) {
+        fprintf(stderr, "rp6502_bench: can't open script %s\n", path);
+        exit(2);
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), fp)) {
+        char *hash = strchr(line, '#');
+        if (hash) *hash = '\0';
+        char *p = line, *end;
+        unsigned long f = strtoul(p, &end, 0);
+        if (end == p) continue;
+        InputStep step;
+        memset(&step, 0, sizeof(step));
+        step.frame = f;
+        for (p = end;;) {
+            unsigned long code = strtoul(p, &end, 0);
+            if (end == p) break;
+            step.keys[(code >> 3) & (KEYBOARD_BYTES - 1)] |= 1 << (code & 7);
+            p = end;
+        }
+        b.script.push_back(step);
+    }
+    fclose(fp);
+}
+
+static bool is_subsystem(const std::string &n)
+{
+    return n.rfind("update_", 0) == 0 || n.rfind("check_", 0) == 0 ||
+           n == "collision_run" || n == "flush_sprites" || n == "handle_input";
+}
+
+static void report(Bench &b, bool all)
+{
+    unsigned long frames = b.frames_measured ? b.frames_measured : 1;
+
+    printf("\n=== rp6502_bench: %lu frames, budget %llu cycles (PHI2 %u kHz) ===\n",
+           b.frames_measured, (unsigned long long)b.budget, b.phi2_khz);
+    printf("frame avg %llu  max %llu (frame %lu, %.0f%% of budget)  overruns %lu\n",
+           (unsigned long long)(b.busy_total / frames), (unsigned long long)b.busy_max,
+           b.busy_max_frame, 100.0 * b.busy_max / b.budget, b.overruns);
+
+    std::vector<Symbol *> rows;
+    for (Symbol &s : b.syms) {
+        if (!s.total) continue;
+        if (all || is_subsystem(s.name)) rows.push_back(&s);
+    }
+    std::sort(rows.begin(), rows.end(), [](Symbol *x, Symbol *y) { return x->total > y->total; });
+    if (all && rows.size() > 40) rows.resize(40);
+
+    printf("%-28s %9s %10s %10s %7s\n", "function", "calls/f", "avg/frame", "max/frame", "%budget");
+    for (Symbol *s : rows) {
+        uint64_t avg = s->total / frames;
+        printf("%-28s %9.2f %10llu %10llu %6.1f%%\n", s->name.c_str(),
+               (double)s->calls / frames, (unsigned long long)avg,
+               (unsigned long long)s->frame_max, 100.0 * avg / b.budget);
+    }
+}
+
+static void usage(void)
+{
+    fprintf(stderr,
+        "usage: rp6502_bench ROM.rp6502 [--map FILE] [--script FILE] [--frames N]\n"
+        "                    [--phi2 KHZ] [--allow N] [--warmup N] [--all] [--quiet]\n");
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    static Bench b;
+    const char *rom = NULL, *map = NULL, *script = NULL;
+    unsigned long allow = 0;
+    bool all = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        bool more = i + 1 < argc;
+        if (a == "--map" && more) map = argv[++i];
+        else if (a == "--script" && more) script = argv[++i];
+        else if (a == "--frames" && more) b.frame_limit = strtoul(argv[++i], NULL, 0);
+        else if (a == "--phi2" && more) b.phi2_khz = strtoul(argv[++i], NULL, 0);
+        else if (a == "--allow" && more) allow = strtoul(argv[++i], NULL, 0);
+        else if (a == "--warmup" && more) b.warmup = strtoul(argv[++i], NULL, 0);
+        else if (a == "--all") all = true;
+        else if (a == "--quiet") b.quiet = true;
+        else if (a[0] != '-' && !rom) rom = argv[i];
+        else usage();
+    }
+    if (!rom) usage();
+
+    if (!load_rom(b, rom)) {
+        fprintf(stderr, "rp6502_bench: can't load ROM %s\n", rom);
+        return 2;
+    }
+    if (map) load_map(b, map);
+    if (script) load_script(b, script);
+
+    b.budget = (uint64_t)b.phi2_khz * 1000 / 60;
+
+    // RIA op handshake: "BRA *+0; LDA #a; LDX #x; RTS" with busy clear
+    b.cpu.ram[RIA_SPIN] = 0x80;
+    b.cpu.ram[RIA_SPIN + 1] = 0x00;
+    b.cpu.ram[RIA_SPIN + 2] = 0xA9;
+    b.cpu.ram[RIA_SPIN + 4] = 0xA2;
+    b.cpu.ram[RIA_SPIN + 6] = 0x60;
+
+    b.cpu.ctx = &b;
+    b.cpu.io_read = Bench::io_read;
+    b.cpu.io_write = Bench::io_write;
+    b.cpu.on_jsr = Bench::on_jsr;
+    b.cpu.on_rts = Bench::on_rts;
+    b.cpu.reset();
+    b.apply_input();
+
+    while (!b.exited && !b.cpu.stopped) {
+        b.cpu.step();
+        if (b.frame_limit && b.tick() >= b.frame_limit) break;
+    }
+    fflush(stdout);
+
+    report(b, all);
+
+    if (b.overruns > allow) {
+        printf("FAIL: %lu frame(s) over budget (allowed %lu)\n", b.overruns, allow);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,46 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include "anim.h"
+
+void anim_restart(AnimCursor *a, const AnimClip *clip)
+{
+    a->clip = clip;
+    a->next = clip;
+    a->frame = 0;
+    a->ticks = clip->ticks[0];
+    a->changed = true;
+}
+
+void anim_play(AnimCursor *a, const AnimClip *clip)
+{
+    a->next = clip;
+}
+
+AnimStep anim_step(AnimCursor *a)
+{
+    if (--a->ticks == 0) {
+        const AnimClip *clip = a->clip;
+
+        if (a->next != clip) {
+            // Frame's over: hand over to the clip that was asked for
+            a->clip = clip = a->next;
+            a->frame = 0;
+        } else if (++a->frame >= clip->count) {
+            if (!clip->loop) {
+                // Hold the last frame and keep saying so
+                a->frame = clip->count - 1;
+                a->ticks = 1;
+                return ANIM_DONE;
+            }
+            a->frame = 0;
+        }
+        a->ticks = clip->ticks[a->frame];
+        a->changed = true;
+    }
+
+    if (a->changed) {
+        a->changed = false;
+        return ANIM_CHANGED;
+    }
+    return ANIM_SAME;
+}
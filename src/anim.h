@@ -0,0 +1,64 @@
+#ifndef ANIM_H
+#define ANIM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ============================================================================
+// ANIMATION CLIPS
+// ============================================================================
+// A clip is a const list of frames, each with how many ticks it stays up.
+// The clips themselves are generated by tools/luts.py (ANIM_* in luts.h).
+// A frame's cell is what to show: the XRAM sprite pointer for plain sprites,
+// or a frame number into the owner's table for composite ones (chopper
+// blades, balloon halves, tank metasprite).
+//
+// Every animated thing keeps an AnimCursor and calls anim_step() once per
+// tick. anim_step() says when the cell actually changed, so the sprite
+// pointer is only written then:
+//
+//     anim_play(&a, &ANIM_FOO);            // Takes over when this frame ends
+//     if (anim_step(&a) == ANIM_CHANGED) {
+//         sprite_set(slot, xram_sprite_ptr, anim_cell(&a));
+//     }
+//
+// anim_play() only switches clips at a frame boundary, so an object that
+// flips between two clips every tick (a hostage bumping into the crowd)
+// still keeps a steady frame rate.
+
+typedef struct {
+    uint8_t count;              // Frames in the clip
+    bool loop;                  // Start over after the last frame, else hold it
+    const uint16_t *cells;      // What each frame shows (see above)
+    const uint8_t *ticks;       // How long each frame stays up
+} AnimClip;
+
+typedef struct {
+    const AnimClip *clip;
+    const AnimClip *next;       // Clip to switch to when this frame ends
+    uint8_t frame;
+    uint8_t ticks;              // Ticks left on the current frame
+    bool changed;               // Cell changed since the last anim_step()
+} AnimCursor;
+
+typedef enum {
+    ANIM_SAME = 0,              // Still on the same cell
+    ANIM_CHANGED,               // Show anim_cell() now
+    ANIM_DONE                   // A clip that doesn't loop has run out
+} AnimStep;
+
+// Play a clip from its first frame once the current frame is over. Asking
+// for the clip that is already playing changes nothing, so it can be
+// called every tick.
+extern void anim_play(AnimCursor *a, const AnimClip *clip);
+
+// Start a clip from its first frame right now (new objects, reused slots)
+extern void anim_restart(AnimCursor *a, const AnimClip *clip);
+
+// One tick. Returns ANIM_DONE (every tick, holding the last frame) once a
+// non-looping clip has run out.
+extern AnimStep anim_step(AnimCursor *a);
+
+#define anim_cell(a)    ((a)->clip->cells[(a)->frame])
+
+#endif // ANIM_H
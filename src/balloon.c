@@ -11,29 +11,24 @@
 #include "explosion.h"
 #include "homebase.h"
 #include "sound.h"
+#include "sprites.h"
+#include "collision.h"
+#include "world.h"
+#include "rng.h"
+#include "luts.h"
 
 
-#define BALLOON_GROUND_Y        (GROUND_Y_SUB + (12 << SUBPIXEL_BITS)) // Ground level for balloon crash
+#define BALLOON_GROUND_Y        (GROUND_Y_SUB + (12 << SUBPIXEL_BITS_Y)) // Ground level for balloon crash
 
 Balloon balloon; 
 
-// Sprite Data Offsets (16x16 = 512 bytes)
-// Frame 0: Bottom=0, Top=512
-// Frame 1: Bottom=1024, Top=1536
-// Frame 2: Bottom=2048, Top=2560
-uint16_t get_balloon_ptr(int frame, int part) {
-    // part 0 = Bottom, part 1 = Top
-    int base_idx = frame * 2; 
-    return BALLOON_DATA + ((base_idx + part) * 512);
-}
-
 void reset_balloon(void) {
     balloon.active = false;
     balloon.respawn_timer = 0; // Reset so it spawns when criteria are met
     
     // Hide Sprites
-    xram0_struct_set(BALLOON_BOTTOM_CONFIG, vga_mode4_sprite_t, y_pos_px, -32);
-    xram0_struct_set(BALLOON_TOP_CONFIG, vga_mode4_sprite_t, y_pos_px, -32);
+    sprite_hide(SPR_BALLOON_BOTTOM);
+    sprite_hide(SPR_BALLOON_TOP);
 }
 
 
@@ -48,8 +43,8 @@ void update_balloon(void) {
             balloon.respawn_timer--;
             
             // HIDE SPRITES while waiting
-            xram0_struct_set(BALLOON_BOTTOM_CONFIG, vga_mode4_sprite_t, y_pos_px, -32);
-            xram0_struct_set(BALLOON_TOP_CONFIG, vga_mode4_sprite_t, y_pos_px, -32);
+            sprite_hide(SPR_BALLOON_BOTTOM);
+            sprite_hide(SPR_BALLOON_TOP);
             return;
         }
 
@@ -73,7 +68,7 @@ void update_balloon(void) {
             
             // 50/50 Chance, OR biased by player movement? 
             // Let's go random for unpredictability.
-            bool try_right = (rand() % 2 == 0);
+            bool try_right = rng_coin();
 
             if (try_right) {
                 // Try spawning ahead/behind on the right
@@ -108,10 +103,10 @@ void update_balloon(void) {
                 balloon.active = true;
                 balloon.is_falling = false; // Reset falling state
                 balloon.world_x = chosen_x;
-                balloon.y = GROUND_Y_SUB - (60 << SUBPIXEL_BITS); // High altitude
+                balloon.y = GROUND_Y_SUB - (60 << SUBPIXEL_BITS_Y); // High altitude
                 balloon.vx = 0;
                 balloon.vy = 0;
-                balloon.anim_frame = 0;
+                anim_restart(&balloon.anim, &ANIM_BALLOON_FLOAT);
             }
         }
         return; 
@@ -120,19 +115,14 @@ void update_balloon(void) {
     // --- CASE A: FALLING (Shot Down) ---
     if (balloon.is_falling) {
         // 1. Apply Gravity
-        balloon.vy += 2; // Gravity (0.125 px/frame)
+        balloon.vy += ONE_PIXEL_Y / 8; // Gravity (0.125 px/frame)
         balloon.y += balloon.vy;
         
         // 2. Apply Momentum (optional, usually 0)
         balloon.world_x += balloon.vx;
 
-        // 3. Fast Animation (Spinning/Flailing)
-        balloon.anim_timer++;
-        if (balloon.anim_timer > 2) { // Very fast (every 2 frames)
-            balloon.anim_timer = 0;
-            balloon.anim_frame++;
-            if (balloon.anim_frame > 2) balloon.anim_frame = 0;
-        }
+        // 3. Fast Animation (Spinning/Flailing): ANIM_BALLOON_FALL,
+        //    started when it was shot
 
         // 4. Ground Impact Check
         if (balloon.y >= BALLOON_GROUND_Y) {
@@ -159,11 +149,11 @@ void update_balloon(void) {
         int32_t safety_line = (ENEMY_BASE_LOCATIONS[3] + HOMEBASE_WORLD_X) / 2;
         
         // Floor Ceiling: 32 pixels above ground
-        int32_t min_altitude = GROUND_Y_SUB - (32 << SUBPIXEL_BITS);
+        int32_t min_altitude = GROUND_Y_SUB - (32 << SUBPIXEL_BITS_Y);
         
         // Target: Chopper Center
         int32_t target_x = chopper_world_x + (16 << SUBPIXEL_BITS);
-        int32_t target_y = chopper_y + (8 << SUBPIXEL_BITS);
+        int32_t target_y = chopper_y + (8 << SUBPIXEL_BITS_Y);
 
         // --- X Movement ---
         // If balloon tries to go past the safety line towards home, force it back
@@ -192,71 +182,55 @@ void update_balloon(void) {
     }
 
     // =========================================================
-    // 3. COLLISION: PLAYER (The Balloon hits the Chopper)
+    // 3. COLLISION (bullets, and ramming the chopper; see balloon_on_contact)
     // =========================================================
-    if (player_state == PLAYER_ALIVE && !balloon.is_falling) {
-
-        int32_t target_x = chopper_world_x + (16 << SUBPIXEL_BITS);
-        int32_t target_y = chopper_y + (8 << SUBPIXEL_BITS);
-        
-        // Calculate Balloon Center X (World X + 8px)
-        int32_t balloon_cx = balloon.world_x + (8 << SUBPIXEL_BITS);
-        
-        // Balloon Center Y is just balloon.y 
-        // (Based on render logic: Top is y-16, Bottom is y. Range is y-16 to y+16. Center is y.)
-        int32_t balloon_cy = balloon.y; 
-
-        // 3. Horizontal Check (Center to Center)
-        // Combined radii is ~24px. We use 18px for a tight fit.
-        if (labs(balloon_cx - target_x) < (18 << SUBPIXEL_BITS)) { 
-            
-            // 4. Vertical Check
-            // Combined radii is ~24px. We use 18px.
-            if (labs(balloon_cy - target_y) < (18 << SUBPIXEL_BITS)) {   
-                
-                // CRASH PLAYER
-                kill_player();
-                
-                // DESTROY BALLOON
-                trigger_explosion(balloon.world_x, balloon.y); 
-                balloon.active = false;
-                balloon.respawn_timer = BALLOON_RESPAWN;
-                return;
-            }
-        }
+    if (!balloon.is_falling) {
+        collision_add(COL_BALLOON, 0, WORLD_X16(balloon.world_x), balloon.y);
+        collision_add(COL_BALLOON_TARGET, 0, WORLD_X16(balloon.world_x), balloon.y);
     }
 
     // =========================================================
     // 4. RENDER
     // =========================================================
     
-    // Animation (Slow bobbing)
-    balloon.anim_timer++;
-    if (balloon.anim_timer > 8) {
-        balloon.anim_timer = 0;
-        balloon.anim_frame++;
-        if (balloon.anim_frame > 2) balloon.anim_frame = 0;
+    // Animation (slow bobbing, or the fast spin once shot)
+    if (anim_step(&balloon.anim) == ANIM_CHANGED) {
+        uint8_t f = anim_cell(&balloon.anim);
+        sprite_set(SPR_BALLOON_BOTTOM, xram_sprite_ptr, BALLOON_SPRITE_PTR[f][0]);
+        sprite_set(SPR_BALLOON_TOP, xram_sprite_ptr, BALLOON_SPRITE_PTR[f][1]);
     }
 
     int32_t screen_sub = balloon.world_x - camera_x;
     int16_t screen_px = screen_sub >> SUBPIXEL_BITS;
-    int16_t screen_y = balloon.y >> SUBPIXEL_BITS;
+    int16_t screen_y = Y_PX(balloon.y);
 
-    if (screen_px > -16 && screen_px < 336) {
+    if (ON_SCREEN(screen_px, 16)) {
         
         // Draw Bottom
-        xram0_struct_set(BALLOON_BOTTOM_CONFIG, vga_mode4_sprite_t, x_pos_px, screen_px);
-        xram0_struct_set(BALLOON_BOTTOM_CONFIG, vga_mode4_sprite_t, y_pos_px, screen_y);
-        xram0_struct_set(BALLOON_BOTTOM_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, get_balloon_ptr(balloon.anim_frame, 0));
+        sprite_show(SPR_BALLOON_BOTTOM, screen_px, screen_y);
 
         // Draw Top (16px higher)
-        xram0_struct_set(BALLOON_TOP_CONFIG, vga_mode4_sprite_t, x_pos_px, screen_px);
-        xram0_struct_set(BALLOON_TOP_CONFIG, vga_mode4_sprite_t, y_pos_px, (screen_y - 16));
-        xram0_struct_set(BALLOON_TOP_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, get_balloon_ptr(balloon.anim_frame, 1));
+        sprite_show(SPR_BALLOON_TOP, screen_px, (screen_y - 16));
         
     } else {
         // Offscreen hide
-        xram0_struct_set(BALLOON_BOTTOM_CONFIG, vga_mode4_sprite_t, y_pos_px, -32);
-        xram0_struct_set(BALLOON_TOP_CONFIG, vga_mode4_sprite_t, y_pos_px, -32);
+        sprite_hide(SPR_BALLOON_BOTTOM);
+        sprite_hide(SPR_BALLOON_TOP);
     }
-}
\ No newline at end of file
+}
+
+// Called by collision_run() when the balloon touches the chopper
+void balloon_on_contact(const Collider *target) {
+    if (target->type != COL_CHOPPER) return;
+    if (!balloon.active || balloon.is_falling || player_state != PLAYER_ALIVE) return;
+
+    // CRASH PLAYER
+    kill_player();
+    
+    // DESTROY BALLOON
+    trigger_explosion(balloon.world_x, balloon.y); 
+    balloon.active = false;
+    balloon.respawn_timer = BALLOON_RESPAWN;
+    sprite_hide(SPR_BALLOON_BOTTOM);
+    sprite_hide(SPR_BALLOON_TOP);
+}
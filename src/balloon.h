@@ -1,12 +1,14 @@
 #if !defined(BALLOON_H)
 #define BALLOON_H
 
+#include "anim.h"
+
 // Configuration
 #define BALLOON_SPEED_X       (1 << SUBPIXEL_BITS) // Slow, relentless
-#define BALLOON_SPEED_Y       8 // Slow, relentless
+#define BALLOON_SPEED_Y       (ONE_PIXEL_Y / 2) // Slow, relentless
 #define BALLOON_RESPAWN     300 // 5 seconds
 #define BALLOON_WIDTH       (12 << SUBPIXEL_BITS) // Hitbox width
-#define BALLOON_HEIGHT      (28 << SUBPIXEL_BITS) // Hitbox height
+#define BALLOON_HEIGHT      (28 << SUBPIXEL_BITS_Y) // Hitbox height
 
 // --- BALLOON STATE ---
 typedef struct {
@@ -15,8 +17,7 @@ typedef struct {
     int32_t world_x;
     int32_t y;
     int16_t vx, vy;
-    uint8_t anim_frame;
-    uint8_t anim_timer;
+    AnimCursor anim;    // Cell = BALLOON_SPRITE_PTR frame
     int16_t respawn_timer; // 5 seconds = 300 ticks
 } Balloon;
 
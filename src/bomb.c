@@ -12,6 +12,9 @@
 #include "hostages.h"
 #include "enemybase.h"
 #include "sound.h"
+#include "sprites.h"
+#include "collision.h"
+#include "world.h"
 
 // --- BOMB STATE ---
 bool bomb_active = false;
@@ -19,49 +22,46 @@ int32_t bomb_world_x = 0;
 int32_t bomb_y = 0;       // Using int32 to match world coordinate types
 int32_t bomb_target_y = 0;
 
-static bool last_fire_state = false;
+// Set on the frame the bomb lands on the tank layer; the blast hits at
+// most one tank
+static bool bomb_blast_live = false;
 
-void check_tank_collision_bomb(void) {
-    const int32_t TANK_HALF_WIDTH = (20 << SUBPIXEL_BITS);
+// Called by collision_run() for each enemy box the blast landed in
+void bomb_on_contact(const Collider *target) {
+    if (!bomb_blast_live || target->type != COL_TANK) return;
 
-    for (int t = 0; t < NUM_TANKS; t++) {
-        if (!tanks[t].active) continue;
+    uint8_t t = target->index;
+    if (!pool_is_live(&tank_pool, t)) return;
 
-        int32_t tank_center = tanks[t].world_x + (20 << SUBPIXEL_BITS);
-        int32_t dist = labs(bomb_world_x - tank_center);
+    int32_t tank_center = tank_x[t] + (20 << SUBPIXEL_BITS);
+    bomb_blast_live = false;
 
-        if (dist < TANK_HALF_WIDTH) {
-            // DIRECT HIT
-            tanks[t].health--;
-            
-            if (tanks[t].health <= 0) {
-                tanks[t].active = false;
-                
-                // Trigger Big Explosion
-                trigger_explosion(tank_center, tanks[t].y - (16 << SUBPIXEL_BITS));
-                sfx_explosion_small();
-                
-                // --- NEW: Set Respawn Cooldown ---
-                // Prevent this base from spawning another tank for 3 seconds
-                int base_id = tanks[t].base_id;
-                if (base_id >= 0 && base_id < NUM_ENEMY_BASES) {
-                    base_state[base_id].tank_cooldown = 300; // 300 frames = 5 seconds at 60fps
-
-                    // 2. REPLENISH INVENTORY
-                    // This allows the base to spawn a replacement tank later
-                    base_state[base_id].tanks_remaining++; 
-                }
-
-            } else {
-                // Damaged (Optional: Spawn small spark)
-                spawn_small_explosion(bomb_world_x, tanks[t].y - (16<<4));
-                sfx_explosion_small();
-            }
-            
-            // Hide bomb
-            xram0_struct_set(BOMB_CONFIG, vga_mode4_sprite_t, y_pos_px, -32);
-            return; 
+    // DIRECT HIT
+    tank_health[t]--;
+    
+    if (tank_health[t] == 0) {
+        pool_free(&tank_pool, t);
+        metasprite_hide(&tank_meta[t]);
+        
+        // Trigger Big Explosion
+        trigger_explosion(tank_center, tank_y[t] - (16 << SUBPIXEL_BITS_Y));
+        sfx_explosion_small();
+        
+        // --- NEW: Set Respawn Cooldown ---
+        // Prevent this base from spawning another tank for 3 seconds
+        int base_id = tank_base[t];
+        if (base_id >= 0 && base_id < NUM_ENEMY_BASES) {
+            base_state[base_id].tank_cooldown = 300; // 300 frames = 5 seconds at 60fps
+
+            // 2. REPLENISH INVENTORY
+            // This allows the base to spawn a replacement tank later
+            base_state[base_id].tanks_remaining++; 
         }
+
+    } else {
+        // Damaged (Optional: Spawn small spark)
+        spawn_small_explosion(WORLD_X16(bomb_world_x), tank_y[t] - (16 << SUBPIXEL_BITS_Y));
+        sfx_explosion_small();
     }
 }
 
@@ -71,7 +71,7 @@ void update_bomb(void) {
     // 1. SPAWN LOGIC
     // =========================================================
     // Trigger: Action Pressed AND Facing Center AND No active bomb
-    if (is_action_pressed(0, ACTION_FIRE) && !last_fire_state && !bomb_active) {
+    if (is_action_just_pressed(0, ACTION_FIRE) && !bomb_active) {
         
         if (current_heading == FACING_CENTER) {
             bomb_active = true;
@@ -81,7 +81,7 @@ void update_bomb(void) {
             bomb_world_x = chopper_world_x + (12 << SUBPIXEL_BITS);
             
             // Spawn at Chopper Bottom
-            bomb_y = chopper_y + (12 << SUBPIXEL_BITS);
+            bomb_y = chopper_y + (12 << SUBPIXEL_BITS_Y);
 
             // --- DEPTH LOGIC ---
             // If we are High Up, the bomb falls "Deep" (to the Tank layer)
@@ -95,12 +95,6 @@ void update_bomb(void) {
             sfx_bomb_drop();
         }
     }
-    // Note: We don't update last_fire_state here because update_bullet() or 
-    // update_chopper_state might handle the "Fire" button debounce globally. 
-    // If not, uncomment this:
-    last_fire_state = is_action_pressed(0, ACTION_FIRE);
-    // last_fire_state = fire_pressed; 
-
     // =========================================================
     // 2. PHYSICS & IMPACT
     // =========================================================
@@ -113,15 +107,16 @@ void update_bomb(void) {
             bomb_active = false;
             
             // 1. Visual Effect
-            spawn_small_explosion(bomb_world_x + (4 << SUBPIXEL_BITS), bomb_target_y);
+            spawn_small_explosion(WORLD_X16(bomb_world_x + (4 << SUBPIXEL_BITS)), bomb_target_y);
 
-            // 2. Check Collisions (Only if hitting Tank Layer)
+            // 2. Blast the Tank Layer (see bomb_on_contact)
             if (bomb_target_y == TARGET_Y_TANKS) {
-                check_tank_collision_bomb();
+                bomb_blast_live = true;
+                collision_add(COL_BOMB_BLAST, 0, WORLD_X16(bomb_world_x), bomb_target_y);
             }
             
             // Hide Sprite
-            xram0_struct_set(BOMB_CONFIG, vga_mode4_sprite_t, y_pos_px, -32);
+            sprite_hide(SPR_BOMB);
         }
     }
 
@@ -132,11 +127,10 @@ void update_bomb(void) {
         int32_t screen_sub = bomb_world_x - camera_x;
         int16_t screen_px = screen_sub >> SUBPIXEL_BITS;
 
-        if (screen_px > -8 && screen_px < 328) {
-            xram0_struct_set(BOMB_CONFIG, vga_mode4_sprite_t, x_pos_px, screen_px);
-            xram0_struct_set(BOMB_CONFIG, vga_mode4_sprite_t, y_pos_px, bomb_y >> SUBPIXEL_BITS);
+        if (ON_SCREEN(screen_px, 8)) {
+            sprite_show(SPR_BOMB, screen_px, Y_PX(bomb_y));
         } else {
-            xram0_struct_set(BOMB_CONFIG, vga_mode4_sprite_t, y_pos_px, -32);
+            sprite_hide(SPR_BOMB);
         }
     }
 }
@@ -2,7 +2,8 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include "boom.h"
-#include "constants.h" // Must define BOOM_CONFIG and BOOM_DATA
+#include "constants.h" // Must define BOOM_DATA
+#include "sprites.h"
 
 // --- STATE ---
 static bool boom_active = false;
@@ -15,11 +16,10 @@ void trigger_boom(int16_t screen_x, int16_t screen_y) {
     boom_timer = 0;
 
     // Set Position
-    xram0_struct_set(BOOM_CONFIG, vga_mode4_sprite_t, x_pos_px, screen_x);
-    xram0_struct_set(BOOM_CONFIG, vga_mode4_sprite_t, y_pos_px, screen_y);
+    sprite_show(SPR_BOOM, screen_x, screen_y);
     
     // Set Frame 0 (Start)
-    xram0_struct_set(BOOM_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, (uint16_t)BOOM_DATA);
+    sprite_set(SPR_BOOM, xram_sprite_ptr, (uint16_t)BOOM_DATA);
 }
 
 void update_boom(void) {
@@ -30,16 +30,16 @@ void update_boom(void) {
     // Switch to Frame 1 after 5 ticks
     if (boom_timer == 5) {
         // Frame 1 is offset by 512 bytes (16x16 * 2)
-        xram0_struct_set(BOOM_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, (uint16_t)(BOOM_DATA + 512));
+        sprite_set(SPR_BOOM, xram_sprite_ptr, (uint16_t)(BOOM_DATA + 512));
     }
     // End animation after 10 ticks
     else if (boom_timer >= 10) {
         boom_active = false;
-        xram0_struct_set(BOOM_CONFIG, vga_mode4_sprite_t, y_pos_px, -32); // Hide
+        sprite_hide(SPR_BOOM); // Hide
     }
 }
 
 void reset_boom(void) {
     boom_active = false;
-    xram0_struct_set(BOOM_CONFIG, vga_mode4_sprite_t, y_pos_px, -32);
+    sprite_hide(SPR_BOOM);
 }
\ No newline at end of file
@@ -5,6 +5,5 @@
 #define NUM_BULLETS     1
 
 extern void update_bullet(void);
-extern void check_bullet_collisions(void);
 
 #endif // BULLETS_H
@@ -4,10 +4,11 @@
 #include "player.h"
 #include "clouds.h"
 #include "constants.h"
+#include "sprites.h"
 
 
 int32_t cloud_world_x[NUM_CLOUDS] = { 100<<4, 300<<4, 500<<4 }; // Spread them out
-int16_t cloud_y[NUM_CLOUDS] = { 30<<4, 50<<4, 20<<4 };          // Different heights
+uint16_t cloud_y[NUM_CLOUDS] = { 30 << SUBPIXEL_BITS_Y, 50 << SUBPIXEL_BITS_Y, 20 << SUBPIXEL_BITS_Y };          // Different heights
 uint8_t cloud_depth_shift[NUM_CLOUDS]; // 1=Fast, 2=Med, 3=Slow
 
 // --- CLOUD DRIFT CONFIG ---
@@ -45,8 +46,6 @@ void update_clouds(void) {
         }
 
         // --- WRITE TO HARDWARE ---
-        unsigned cfg_addr = CLOUD_A_CONFIG + (i * sizeof(vga_mode4_sprite_t));
-        xram0_struct_set(cfg_addr, vga_mode4_sprite_t, x_pos_px, cloud_screen_px);
-        xram0_struct_set(cfg_addr, vga_mode4_sprite_t, y_pos_px, cloud_y[i] >> SUBPIXEL_BITS);
+        sprite_show(SPR_CLOUD + i, cloud_screen_px, Y_PX(cloud_y[i]));
     }
 }
\ No newline at end of file
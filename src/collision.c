@@ -0,0 +1,203 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "constants.h"
+#include "player.h"
+#include "bullets.h"
+#include "ebullets.h"
+#include "hostages.h"
+#include "tanks.h"
+#include "enemybase.h"
+#include "collision.h"
+
+// Shape and collision rules of each ColliderType. Box edges are pixel
+// offsets from the entity's (world_x, y). Hit ranges, for reference:
+//   chopper   centre (+16,+8), +/-12 x +/-8; +/-10 x +/-10 to a jet weapon
+//   hostage   centre (+8,+8),  +/-5 x +/-7; a falling tank bullet in the
+//             last 20px above its ground hits at +/-6 in x, whole band
+//   jet       centre (+8,+4),  +/-12 x +/-8
+//   balloon   centre (+8,0),   +/-10 x +/-18 to a bullet (y is the split
+//             point); rams the chopper at +/-18 between centres
+//   base door x +18..+27, y +4..+13 from GROUND_Y
+//   tank      x +0..+40 (bombs only), y -8..+8 around the tracks
+//   crush     chopper centre +/-(15 or 8) to a hostage centre, x only
+typedef struct {
+    int8_t x0, y0, x1, y1;
+    uint8_t layer;
+    uint8_t hits;
+} ColliderShape;
+
+static const ColliderShape col_types[COL_TYPE_COUNT] = {
+    [COL_CHOPPER]      = {  4,   0, 28, 16, COL_LAYER_PLAYER, 0 },
+    [COL_CHOPPER_JET_TARGET] = { 6, -2, 26, 18, COL_LAYER_JET_TARGET, 0 },
+    [COL_CRUSH_SIDE]   = {  6,   0, 26, 40, 0, COL_LAYER_HOSTAGE },
+    [COL_CRUSH_CENTER] = { 13,   0, 19, 40, 0, COL_LAYER_HOSTAGE },
+    [COL_BULLET]       = {  0,   0,  0,  0, COL_LAYER_PLAYER_SHOT,
+                          COL_LAYER_ENEMY | COL_LAYER_STRUCTURE | COL_LAYER_HOSTAGE },
+    [COL_BOMB_BLAST]   = {  0,   0,  0,  0, COL_LAYER_PLAYER_SHOT, COL_LAYER_ENEMY },
+    [COL_EBULLET]      = {  0,   0,  0,  0, COL_LAYER_ENEMY_SHOT, COL_LAYER_PLAYER },
+    [COL_EBULLET_LOW]  = { -1, -14,  1, 14, 0, COL_LAYER_HOSTAGE },
+    [COL_JET]          = { -4,  -4, 20, 12, COL_LAYER_ENEMY, 0 },
+    [COL_JET_WEAPON]   = {  0,   0,  0,  0, COL_LAYER_ENEMY_SHOT, COL_LAYER_JET_TARGET },
+    [COL_BALLOON]      = {  2, -10, 14, 10, 0, COL_LAYER_PLAYER },
+    [COL_BALLOON_TARGET] = { -2, -18, 18, 18, COL_LAYER_ENEMY, 0 },
+    [COL_BASE]         = { 17,   3, 28, 14, COL_LAYER_STRUCTURE, 0 },
+    [COL_HOSTAGE]      = {  3,   1, 13, 15, COL_LAYER_HOSTAGE, 0 },
+    [COL_TANK]         = {  0,  -8, 40,  8, COL_LAYER_ENEMY, 0 },
+};
+
+// Enough for every pool at once
+#define COL_MAX_COLLIDERS (5 + NUM_BULLETS + 2 * NEBULLET + 4 + NUM_ENEMY_BASES + NUM_HOSTAGES + NUM_TANKS)
+
+// Worst case, so no contact is ever dropped: every hitter touching every
+// box on the layers it hits. Per hitter: bullet (jet, balloon, tanks, bases,
+// hostages), bomb blast (jet, balloon, tanks), tank bullets (chopper, then
+// hostages near the ground), jet weapon and balloon (chopper), skids
+// (hostages). Keep in step with the masks in col_types[].
+#define COL_MAX_CONTACTS (NUM_BULLETS * (2 + NUM_TANKS + NUM_ENEMY_BASES + NUM_HOSTAGES) + \
+                          (2 + NUM_TANKS) + \
+                          NEBULLET * (1 + NUM_HOSTAGES) + \
+                          1 + 1 + \
+                          NUM_HOSTAGES)
+_Static_assert(COL_MAX_CONTACTS <= 255, "contact_count is a uint8_t");
+
+typedef struct {
+    uint8_t hitter;     // Index into colliders[]
+    uint8_t target;
+} Contact;
+
+static Collider colliders[COL_MAX_COLLIDERS];
+static uint8_t collider_count = 0;
+
+static uint8_t col_order[COL_MAX_COLLIDERS];   // colliders[] sorted by x0
+
+// X index: boxes are binned by left edge into 64px buckets spanning the
+// +/-2048px a camera-relative x can take (the whole 4096px world), so
+// sorting never depends on the order the pools registered in
+#define COL_BUCKET_SHIFT 6
+#define COL_BUCKET_COUNT (4096 >> COL_BUCKET_SHIFT)
+#define COL_BUCKET_BIAS  2048
+
+static uint8_t col_bucket[COL_MAX_COLLIDERS];   // Bucket of each box
+static uint8_t bucket_start[COL_BUCKET_COUNT];  // First col_order slot
+
+static Contact contacts[COL_MAX_CONTACTS];
+static uint8_t contact_count = 0;
+
+void collision_begin(void)
+{
+    collider_count = 0;
+}
+
+Collider *collision_add(ColliderType type, uint8_t index, WorldX16 world_x, int32_t y)
+{
+    if (collider_count >= COL_MAX_COLLIDERS) return NULL;
+
+    const ColliderShape *s = &col_types[type];
+    Collider *c = &colliders[collider_count++];
+
+    // World subpixels to camera-relative pixels. The chopper registers
+    // before update_world_view(), so take the camera straight from camera_x.
+    int16_t px = WORLD_DX16(world_x, camera_x) >> SUBPIXEL_BITS;
+    int16_t py = Y_PX(y);
+
+    c->x0 = px + s->x0;
+    c->x1 = px + s->x1;
+    c->y0 = py + s->y0;
+    c->y1 = py + s->y1;
+    c->type = type;
+    c->index = index;
+    c->layer = s->layer;
+    c->hits = s->hits;
+    return c;
+}
+
+static void add_contact(uint8_t hitter, uint8_t target)
+{
+    if (contact_count < COL_MAX_CONTACTS) {
+        contacts[contact_count].hitter = hitter;
+        contacts[contact_count].target = target;
+        contact_count++;
+    }
+}
+
+static void dispatch(const Collider *hitter, const Collider *target)
+{
+    switch (hitter->type) {
+        case COL_BULLET:       bullet_on_contact(target); break;
+        case COL_BOMB_BLAST:   bomb_on_contact(target); break;
+        case COL_EBULLET:
+        case COL_EBULLET_LOW:  ebullet_on_contact(hitter->index, target); break;
+        case COL_JET_WEAPON:   jet_weapon_on_contact(target); break;
+        case COL_BALLOON:      balloon_on_contact(target); break;
+        case COL_CRUSH_SIDE:
+        case COL_CRUSH_CENTER: hostage_on_crush(target); break;
+        default: break;
+    }
+}
+
+void collision_run(void)
+{
+    uint8_t n = collider_count;
+
+    // Bin by left edge: count per bucket, turn counts into start slots,
+    // then drop each box into its bucket. Clamping keeps buckets in x order.
+    for (uint8_t b = 0; b < COL_BUCKET_COUNT; b++) bucket_start[b] = 0;
+
+    for (uint8_t i = 0; i < n; i++) {
+        int16_t bx = colliders[i].x0 + COL_BUCKET_BIAS;
+        uint8_t b;
+        if (bx < 0) b = 0;
+        else if ((bx >> COL_BUCKET_SHIFT) >= COL_BUCKET_COUNT) b = COL_BUCKET_COUNT - 1;
+        else b = (uint8_t)(bx >> COL_BUCKET_SHIFT);
+        col_bucket[i] = b;
+        bucket_start[b]++;
+    }
+
+    uint8_t slot = 0;
+    for (uint8_t b = 0; b < COL_BUCKET_COUNT; b++) {
+        uint8_t count = bucket_start[b];
+        bucket_start[b] = slot;
+        slot += count;
+    }
+
+    for (uint8_t i = 0; i < n; i++) {
+        col_order[bucket_start[col_bucket[i]]++] = i;
+    }
+
+    // Insertion sort by left edge. Only boxes sharing a bucket can be out
+    // of order, so this costs the few boxes per bucket, not n squared.
+    for (uint8_t i = 1; i < n; i++) {
+        uint8_t k = i;
+        uint8_t ci = col_order[i];
+        int16_t x0 = colliders[ci].x0;
+        while (k > 0 && colliders[col_order[k - 1]].x0 > x0) {
+            col_order[k] = col_order[k - 1];
+            k--;
+        }
+        col_order[k] = ci;
+    }
+
+    // Sweep: each box only meets the boxes that start before it ends
+    contact_count = 0;
+    for (uint8_t i = 0; i < n; i++) {
+        uint8_t ai = col_order[i];
+        const Collider *a = &colliders[ai];
+
+        for (uint8_t j = i + 1; j < n; j++) {
+            uint8_t bi = col_order[j];
+            const Collider *b = &colliders[bi];
+
+            if (b->x0 >= a->x1) break;
+            if (a->x0 >= b->x1) continue;    // b is a point on a's left edge
+            if (b->y0 >= a->y1 || a->y0 >= b->y1) continue;
+
+            if (a->hits & b->layer) add_contact(ai, bi);
+            if (b->hits & a->layer) add_contact(bi, ai);
+        }
+    }
+
+    for (uint8_t c = 0; c < contact_count; c++) {
+        dispatch(&colliders[contacts[c].hitter], &colliders[contacts[c].target]);
+    }
+}
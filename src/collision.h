@@ -0,0 +1,85 @@
+#ifndef COLLISION_H
+#define COLLISION_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "world.h"
+
+// ============================================================================
+// COLLISION SERVICE
+// ============================================================================
+// One place for every hitbox in the game. Each frame:
+//
+//   1. collision_begin() empties the collider table (top of the main loop).
+//   2. While they update, entities call collision_add() with their type,
+//      pool index and position (WorldX16 and 8.8 y, see world.h and
+//      SUBPIXEL_BITS_Y). The box
+//      comes from the shape table in collision.c and is stored as pixels
+//      relative to camera_x, so nothing here touches 32-bit coordinates.
+//   3. collision_run() (once, after every update_*) bins the boxes into
+//      64px X buckets, sorts them by left edge within each bucket and sweeps
+//      them, so the cost grows with the boxes, not with their pairs.
+//      Whenever a box's `hits` mask contains the other box's `layer` and
+//      the boxes overlap, a contact is recorded. The contacts are then
+//      handed to the module that owns the hitting box.
+//
+// A hit is a strict overlap, so a shot (a zero-size box) must be inside the
+// target, not on its edge. Shapes, layers and masks live in col_types[] in
+// collision.c: that table is what to tune.
+//
+// Handlers run after the frame's sprites were placed, so anything they
+// remove must also hide its sprites.
+
+// What a box is (bit per layer)
+#define COL_LAYER_PLAYER        0x01
+#define COL_LAYER_PLAYER_SHOT   0x02
+#define COL_LAYER_ENEMY         0x04
+#define COL_LAYER_ENEMY_SHOT    0x08
+#define COL_LAYER_HOSTAGE       0x10
+#define COL_LAYER_STRUCTURE     0x20
+#define COL_LAYER_JET_TARGET    0x40    // The chopper, as the jet's weapon sees it
+
+// Every kind of box, index into col_types[]
+typedef enum {
+    COL_CHOPPER,            // Player body (target for enemy fire)
+    COL_CHOPPER_JET_TARGET, // Player body as a target for jet weapons
+    COL_CRUSH_SIDE,         // Chopper skids, low and facing sideways
+    COL_CRUSH_CENTER,       // Chopper skids, low and facing the screen
+    COL_BULLET,             // Player bullet
+    COL_BOMB_BLAST,         // Player bomb, the frame it lands on the tank layer
+    COL_EBULLET,            // Tank bullet (index = tank_bullets slot)
+    COL_EBULLET_LOW,        // Same bullet falling through the hostages' band
+    COL_JET,
+    COL_JET_WEAPON,         // Jet bullet or bomb
+    COL_BALLOON,            // Balloon ramming the chopper
+    COL_BALLOON_TARGET,     // Balloon as a target for bullets
+    COL_BASE,               // Enemy base door (index = base)
+    COL_HOSTAGE,            // index = hostages slot
+    COL_TANK,               // index = tanks slot
+    COL_TYPE_COUNT
+} ColliderType;
+
+typedef struct {
+    int16_t x0, y0, x1, y1;  // Pixels, x relative to camera_x
+    uint8_t type;            // ColliderType
+    uint8_t index;           // Slot in the owner's pool
+    uint8_t layer;           // COL_LAYER_* this box is on
+    uint8_t hits;            // COL_LAYER_* this box reports contacts with
+} Collider;
+
+extern void collision_begin(void);
+
+// Returns the new box (so the caller can narrow `hits`), or NULL if full
+extern Collider *collision_add(ColliderType type, uint8_t index, WorldX16 world_x, int32_t y);
+
+extern void collision_run(void);
+
+// Contact handlers, one per hitting type (defined by the owning module)
+extern void bullet_on_contact(const Collider *target);
+extern void bomb_on_contact(const Collider *target);
+extern void ebullet_on_contact(uint8_t b, const Collider *target);
+extern void jet_weapon_on_contact(const Collider *target);
+extern void balloon_on_contact(const Collider *target);
+extern void hostage_on_crush(const Collider *target);
+
+#endif // COLLISION_H
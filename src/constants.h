@@ -24,10 +24,10 @@
 // Screen is 240 pixels tall.
 // Top: Leave room for HUD or status bar?
 #define CEILING_Y       40  
-#define CEILING_Y_SUB (CEILING_Y << SUBPIXEL_BITS)
+#define CEILING_Y_SUB ((uint16_t)CEILING_Y << SUBPIXEL_BITS_Y)
 // Bottom: 240 - 16 (Chopper Height) - 10 (Margin for ground tiles)
 #define GROUND_Y        186 
-#define GROUND_Y_SUB (GROUND_Y << SUBPIXEL_BITS)
+#define GROUND_Y_SUB ((uint16_t)GROUND_Y << SUBPIXEL_BITS_Y)
 // Left and Right boundaries can be full width
 #define LEFT_BOUNDARY   (SCREEN_WIDTH / 2 - 40)
 #define LEFT_BOUNDARY_SUB (LEFT_BOUNDARY << SUBPIXEL_BITS)
@@ -40,121 +40,19 @@
 
 // XRAM Memory Layout for RPMegaChopper
 // ---------------------------------------------------------------------------
-// We have a total of 65536 bytes (64KB) of XRAM to work with. We'll allocate
-// space for the Chopper sprites, background tiles, maps, and soldier sprites.
-
-// Chopper Sprite Sheet (22 frames, 2x 16x16 sprites per frame)
-// Total Size: 22,528 bytes (0x5800)
-#define SPRITE_DATA_START       0x0000U // Starting address in XRAM for sprite data
-#define CHOPPER_DATA_SIZE       0x5800U // Size of the chopper sprite data
-#define CHOPPER_DATA            SPRITE_DATA_START // Chopper sprite data address
-#define GROUND_DATA            (SPRITE_DATA_START + CHOPPER_DATA_SIZE) // Ground tile data address
-#define GROUND_DATA_SIZE        0x500U // Size of the ground tile data (each is 128 bytes so 10 tiles is 10*128=1280=0x500)
-
-#define CLOUD_A_DATA           (GROUND_DATA + GROUND_DATA_SIZE) // Cloud A sprite data address
-#define CLOUD_A_DATA_SIZE       0x0800U // Size of Cloud A sprite data (512 bytes)
-#define CLOUD_B_DATA           (CLOUD_A_DATA + CLOUD_A_DATA_SIZE) // Cloud B sprite data address
-#define CLOUD_B_DATA_SIZE       0x0800U // Size of Cloud B sprite data (512 bytes)
-#define CLOUD_C_DATA           (CLOUD_B_DATA + CLOUD_B_DATA_SIZE) // Cloud C sprite data address
-#define CLOUD_C_DATA_SIZE       0x0200U // Size of Cloud C sprite data (256 bytes)
-
-#define LANDINGPAD_DATA        (CLOUD_C_DATA + CLOUD_C_DATA_SIZE) // Landing Pad sprite data address
-#define LANDINGPAD_DATA_SIZE    0x1200U // Size of Landing Pad sprite data
-
-#define HOMEBASE_DATA          (LANDINGPAD_DATA + LANDINGPAD_DATA_SIZE) // Home Base sprite data address
-#define HOMEBASE_DATA_SIZE      0x0C00U // Size of Home Base sprite data
-
-#define ENEMYBASE_DATA         (HOMEBASE_DATA + HOMEBASE_DATA_SIZE) // Enemy Base sprite data address
-#define ENEMYBASE_DATA_SIZE     0x1800U // Size of Enemy Base sprite
-
-#define FLAGS_DATA             (ENEMYBASE_DATA + ENEMYBASE_DATA_SIZE) // Flag sprite data address
-#define FLAGS_DATA_SIZE         0x0400U // Size of Flag sprite data
-
-#define HOSTAGES_DATA           (FLAGS_DATA + FLAGS_DATA_SIZE) // Hostages sprite data address
-#define HOSTAGES_DATA_SIZE      0x1400U // Size of Hostages sprite data
-
-#define BULLET_DATA            (HOSTAGES_DATA + HOSTAGES_DATA_SIZE) // Bullet sprite data address
-#define BULLET_DATA_SIZE        0x0008U // Size of Bullet sprite data
-
-#define EXPLOSION_DATA         (BULLET_DATA + BULLET_DATA_SIZE) // Explosion sprite data address
-#define EXPLOSION_DATA_SIZE     0x1400U // Size of Explosion sprite data
-
-#define SMALL_EXPLOSION_DATA     (EXPLOSION_DATA + EXPLOSION_DATA_SIZE) // Small Explosion sprite data address
-#define SMALL_EXPLOSION_DATA_SIZE 0x0380U // Size of Small Explosion sprite
-
-#define TANK_DATA              (SMALL_EXPLOSION_DATA + SMALL_EXPLOSION_DATA_SIZE) // Tank sprite data address
-#define TANK_DATA_SIZE          0x0B00U // Size of Tank sprite data
-
-#define BOOM_DATA              (TANK_DATA + TANK_DATA_SIZE) // Boom sprite data address
-#define BOOM_DATA_SIZE          0x0400U // Size of Boom sprite data
-
-#define BALLOON_DATA            (BOOM_DATA + BOOM_DATA_SIZE) // Balloon sprite data address
-#define BALLOON_DATA_SIZE       0x0C00U // Size of Balloon sprite data
-
-#define JET_DATA              (BALLOON_DATA + BALLOON_DATA_SIZE) // Jet sprite data address
-#define JET_DATA_SIZE          0x0200U // Size of Jet sprite data
-
-#define BOMB_DATA              (JET_DATA + JET_DATA_SIZE) // Bomb sprite data address
-#define BOMB_DATA_SIZE          0x0080U // Size of Bomb sprite data
-
-#define MINICHOPPER_DATA        (BOMB_DATA + BOMB_DATA_SIZE) // Mini Chopper sprite data address
-#define MINICHOPPER_DATA_SIZE   0x0080U // Size of Mini Chopper sprite data
-
-#define SPRITE_DATA_END        (MINICHOPPER_DATA + MINICHOPPER_DATA_SIZE) // End of used data area
+// We have a total of 65536 bytes (64KB) of XRAM to work with. Every address
+// and size (*_DATA, *_DATA_SIZE, SPRITE_DATA_END, GROUND_MAP_START,
+// GROUND_CONFIG, TEXT_CONFIG, PALETTE_ADDR, GAMEPAD_INPUT, ...) now comes
+// from xram_layout.h, which cmake generates from the table in
+// tools/xram_layout.py. The same table gives the rp6502_asset() load
+// addresses, so add or grow sprite sheets there and nowhere else.
+#include "xram_layout.h"
 
 // Helper macros for navigating the Chopper frames
 // Each frame consists of a LEFT sprite and a RIGHT sprite
 #define SPRITE_SIZE_16x16       512   // Bytes (0x200)
 #define CHOPPER_FRAME_STRIDE    1024  // 2 * 16x16 sprites (0x400)
 
-// 3. SPRITE CONFIGURATION
-// -------------------------------------------------------------------------
-// Configuration data for the chopper sprite
-extern unsigned CHOPPER_CONFIG; // Chopper Sprite Configuration
-extern unsigned CHOPPER_LEFT_CONFIG; // Chopper Left Sprite Configuration
-extern unsigned CHOPPER_RIGHT_CONFIG; // Chopper Right Sprite Configuration
-extern unsigned GROUND_CONFIG;      // Ground Background Configuration
-extern unsigned CLOUD_A_CONFIG;    // Cloud A Sprite Configuration
-extern unsigned LANDINGPAD_CONFIG; // Landing Pad Sprite Configuration
-extern unsigned HOMEBASE_CONFIG;   // Home Base Sprite Configuration
-extern unsigned ENEMYBASE_CONFIG;  // Enemy Base Sprite Configuration
-extern unsigned FLAGS_CONFIG;      // Flags Sprite Configuration
-extern unsigned BULLET_CONFIG;     // Bullet Sprite Configuration
-extern unsigned HOSTAGE_CONFIG;   // Hostage Sprite Configuration
-extern unsigned TEXT_CONFIG;      // Text Plane Configuration
-extern unsigned text_message_addr; // Text message address
-extern unsigned EXPLOSION_LEFT_CONFIG; // Explosion Sprite Configuration
-extern unsigned EXPLOSION_RIGHT_CONFIG;// Explosion Sprite Configuration
-extern unsigned SMALL_EXPLOSION_CONFIG; // Small Explosion Sprite Configuration
-extern unsigned TANK_CONFIG; // Tank Sprite Configuration
-extern unsigned EBULLET_CONFIG; // Enemy Bullet Sprite Configuration
-extern unsigned BOOM_CONFIG; // Boom Sprite Configuration
-extern unsigned BALLOON_BOTTOM_CONFIG; // Balloon Bottom Sprite Configuration
-extern unsigned BALLOON_TOP_CONFIG; // Balloon Top Sprite Configuration
-extern unsigned JET_LEFT_CONFIG; // Jet Left Sprite Configuration
-extern unsigned JET_RIGHT_CONFIG; // Jet Right Sprite Configuration
-extern unsigned BOMB_CONFIG; // Bomb Sprite Configuration
-extern unsigned JET_BULLET_CONFIG; // Jet Bullet Sprite Configuration
-extern unsigned JET_BOMB_CONFIG; // Jet Bomb Sprite Configuration
-extern unsigned MINICHOPPER_CONFIG; // Mini Chopper Sprite Configuration
-
-// 4. TILE MAP CONFIGURATION
-// -------------------------------------------------------------------------
-// Configuration data for the ground background
-extern unsigned GROUND_MAP_START; // Ground Background Configuration
-#define GROUND_MAP_SIZE            0x0258  // 600 bytes
-extern unsigned GROUND_MAP_END;
-
-// PALETTE DATA
-// -------------------------------------------------------------------------
-#define PALETTE_ADDR 0xFF58  // XRAM address for palette data
-
-// 5. Keyboard, Gamepad and Sound
-// -------------------------------------------------------------------------
-#define GAMEPAD_INPUT   0xFF78  // XRAM address for gamepad data
-#define KEYBOARD_INPUT  0xFFA0  // XRAM address for keyboard data
-#define PSG_XRAM_ADDR   0xFFC0  // PSG memory location (must match sound.c)
-
 // Controller input
 #define GAMEPAD_COUNT 4       // Support up to 4 gamepads
 #define GAMEPAD_DATA_SIZE 10  // 10 bytes per gamepad
@@ -163,6 +61,7 @@ extern unsigned GROUND_MAP_END;
 // Button definitions
 #define KEY_ESC 0x29       // ESC key
 #define KEY_ENTER 0x28     // ENTER key
+#define KEY_F9 0x42        // F9 key (frame stats dump)
 
 // Hardware button bit masks - DPAD
 #define GP_DPAD_UP        0x01
@@ -206,6 +105,16 @@ extern unsigned GROUND_MAP_END;
 #define SUBPIXEL_BITS   4       // 2^4 = 16
 #define ONE_PIXEL       (1 << SUBPIXEL_BITS) // Value 16
 
+// Vertical positions and speeds are 8.8 instead: the pixel row is the high
+// byte, so Y_PX() is a byte load rather than a 4-step shift. On-screen Y
+// (chopper, bullet, tanks, hostages, small explosions, clouds) is a
+// uint16_t, which covers rows 0..255; things that can leave through the top
+// of the screen (jet, balloon, bomb, tank bullets) keep an int32_t.
+// X stays 12.4: the 4096px world needs all 16 bits (see WorldX16).
+#define SUBPIXEL_BITS_Y 8       // 2^8 = 256
+#define ONE_PIXEL_Y     (1 << SUBPIXEL_BITS_Y)
+#define Y_PX(y)         ((int16_t)((y) >> SUBPIXEL_BITS_Y))
+
 // Chopper animation frames
 // LEFT FACING
 #define FRAME_LEFT_IDLE         0   // 0-1
@@ -229,8 +138,18 @@ extern unsigned GROUND_MAP_END;
 #define ACCEL_RATE              1       // 2/16ths pixel accel per frame
 #define FRICTION_RATE           1       // 1/16th pixel friction
 
-#define GRAVITY_SPEED   8 // (1 << SUBPIXEL_BITS)   // Pixels per frame to fall when idle
-#define CLIMB_SPEED     (1 << SUBPIXEL_BITS)   // Pixels per frame to rise
-#define DIVE_SPEED      (2 << SUBPIXEL_BITS)   // Pixels per frame to force down
+#define GRAVITY_SPEED   (ONE_PIXEL_Y / 2)         // Half a pixel per frame to fall when idle
+#define CLIMB_SPEED     (1 << SUBPIXEL_BITS_Y)   // Pixels per frame to rise
+#define DIVE_SPEED      (2 << SUBPIXEL_BITS_Y)   // Pixels per frame to force down
+
+// Zero page. Pool arrays that every update loop walks slot by slot keep
+// their per-slot flag here so the test is a 3-cycle zp,X load. There are
+// only ~200 free bytes, so reserve it for the small hot arrays; the host
+// build has no zero page and ignores the section.
+#ifdef __mos__
+#define ZEROPAGE __attribute__((section(".zp.bss")))
+#else
+#define ZEROPAGE
+#endif
 
 #endif // CONSTANTS_H
\ No newline at end of file
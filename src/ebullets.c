@@ -10,50 +10,37 @@
 #include "smallexplosion.h"
 #include "hostages.h"
 #include "sound.h"
-
-// --- TANK AIMING TABLES ---
-// Speed approx 4.5 pixels/frame (72 subpixels)
+#include "sprites.h"
+#include "collision.h"
+#include "world.h"
+#include "pool.h"
+#include "rng.h"
+#include "luts.h"
+
+// --- TANK AIMING ---
+// Shot velocities per aim bin (TANK_AIM_VX/VY, already scaled) are
+// generated by tools/luts.py.
 // Angles: 90 (Up), ~70, ~45, ~25, ~10 degrees
 
-#define AIM_LEAD_Y      (32 << SUBPIXEL_BITS) // Aim 32px above chopper to compensate for gravity
-
-#define VELOCITY_FACTOR 3
-const int16_t TANK_AIM_VX[] = {
-    0,   // Index 0: Up (0.0 px)
-    11,  // Index 1: Steep (0.7 px)
-    23,  // Index 2: Diag (1.4 px)
-    29,  // Index 3: Shallow (1.8 px)
-    32   // Index 4: Low (2.0 px)
-};
-
-const int16_t TANK_AIM_VY[] = {
-    -32, // Index 0: Up (-2.0 px)
-    -30, // Index 1: Steep (-1.8 px)
-    -23, // Index 2: Diag (-1.4 px)
-    -13, // Index 3: Shallow (-0.8 px)
-    -5   // Index 4: Low (-0.3 px)
-};
+#define AIM_LEAD_Y      (32 << SUBPIXEL_BITS_Y) // Aim 32px above chopper to compensate for gravity
 
 // --- TANK BULLET STATE ---
 typedef struct {
-    bool active;
-    int32_t world_x;
+    WorldX16 world_x;
     int32_t y;      // Using int32 for Y to handle the subpixel arc precision better
     int16_t vx;
     int16_t vy;
 } TankBullet;
 
 TankBullet tank_bullets[NEBULLET];
+static Pool ebullet_pool;  // Which tank_bullets[] are in flight
+_Static_assert(NEBULLET <= POOL_MAX_SLOTS, "raise POOL_MAX_SLOTS");
 
-#define EBULLET_GROUND  (GROUND_Y_SUB + (14 << SUBPIXEL_BITS)) // Ground level for enemy bullets
+#define EBULLET_GROUND  (GROUND_Y_SUB + (14 << SUBPIXEL_BITS_Y)) // Ground level for enemy bullets
 
 void reset_tank_bullets(void) {
-    for (int i = 0; i < NEBULLET; i++) {
-        tank_bullets[i].active = false;
-        
-        unsigned cfg = EBULLET_CONFIG + (i * sizeof(vga_mode4_sprite_t));
-        xram0_struct_set(cfg, vga_mode4_sprite_t, y_pos_px, -32);
-    }
+    pool_init(&ebullet_pool, NEBULLET);
+    sprite_hide_range(SPR_EBULLET, NEBULLET);
 }
 
 void update_tank_bullets(void) {
@@ -61,190 +48,162 @@ void update_tank_bullets(void) {
     // =========================================================
     // 1. FIRING LOGIC (AIMED)
     // =========================================================
-    for (int t = 0; t < NUM_TANKS; t++) {
-        if (!tanks[t].active) continue;
+    for (uint8_t k = tank_pool.count; k-- > 0; ) {
+        uint8_t t = tank_pool.live[k];
 
         // --- Decrement Cooldown ---
-        if (tanks[t].fire_cooldown > 0) {
-            tanks[t].fire_cooldown--;
+        if (tank_cooldown[t] > 0) {
+            tank_cooldown[t]--;
             continue; // Cannot fire yet
         }
 
         // Check Visibility
-        int32_t screen_sub = tanks[t].world_x - camera_x;
-        int16_t screen_px = screen_sub >> SUBPIXEL_BITS;
+        int16_t screen_px = SCREEN_PX16(tank_x[t]);
 
-        if (screen_px > -(TANK_WIDTH_PX - 20) && screen_px < SCREEN_WIDTH + (TANK_WIDTH_PX - 20)) {
+        if (ON_SCREEN(screen_px, TANK_WIDTH_PX - 20)) {
             
             // Random Fire Chance (approx 1 per sec)
-            if ((rand() % 100) < 2) { 
+            if (rng_chance(2)) { 
+                
+                // --- SPAWN SETUP ---
+                uint8_t b = pool_alloc(&ebullet_pool);
+                if (b == POOL_NONE) continue; // Both bullets already in flight
+                
+                // Origin: Tank Turret (Center X, Top Y)
+                WorldX16 origin_x = tank_x[t] + (20 << SUBPIXEL_BITS);
+                int32_t origin_y = tank_y[t] - (2 << SUBPIXEL_BITS_Y);
+                
+                tank_bullets[b].world_x = origin_x;
+                tank_bullets[b].y = origin_y;
+
+                // --- AIMING ALGORITHM ---
+                // Target: Center of Chopper, slightly above (Lead)
+                WorldX16 target_x = world.chopper_x16 + (16 << SUBPIXEL_BITS);
+                int32_t target_y = chopper_y - AIM_LEAD_Y;
+
+                // Calculate absolute distances (tank and chopper are
+                // both near the screen, so dx fits 16 bits)
+                int16_t dir_x = WORLD_DX16(target_x, origin_x);
+                int16_t dx = abs(dir_x);
+                // Height diff (positive going up), brought from 8.8 to
+                // dx's 12.4 so the slope tests below compare like units
+                int16_t dy = (origin_y - target_y) >> (SUBPIXEL_BITS_Y - SUBPIXEL_BITS);
+
+                // Clamp dy to avoid divide-by-zero or weirdness if chopper is below tank
+                if (dy < (16 << SUBPIXEL_BITS)) dy = (16 << SUBPIXEL_BITS);
+
+                // Select Angle Index based on Slope (dx / dy)
+                // We use shifts to approximate ratios without division
+                // 0: dx is very small (< 0.25 dy)
+                // 1: dx is small (< 0.75 dy)
+                // 2: dx is medium (< 1.5 dy)
+                // 3: dx is large (< 3.0 dy)
+                // 4: dx is very large (Flat)
+                
+                int aim_idx = 0;
+                if (dx < (dy >> 2)) {
+                    aim_idx = 0; // Straight Up
+                } 
+                else if (dx < (dy - (dy >> 2))) {
+                    aim_idx = 1; // Steep
+                }
+                else if (dx < (dy + (dy >> 1))) {
+                    aim_idx = 2; // Diagonal (45 deg)
+                }
+                else if (dx < ((dy << 1) + dy)) { // dy * 3
+                    aim_idx = 3; // Shallow
+                }
+                else {
+                    aim_idx = 4; // Low
+                }
+
+                // Set Velocity from Lookup Table
+                tank_bullets[b].vy = TANK_AIM_VY[aim_idx];
                 
-                for (int b = 0; b < NEBULLET; b++) {
-                    if (!tank_bullets[b].active) {
-                        
-                        // --- SPAWN SETUP ---
-                        tank_bullets[b].active = true;
-                        
-                        // Origin: Tank Turret (Center X, Top Y)
-                        int32_t origin_x = tanks[t].world_x + (20 << SUBPIXEL_BITS);
-                        int32_t origin_y = tanks[t].y - (2 << SUBPIXEL_BITS);
-                        
-                        tank_bullets[b].world_x = origin_x;
-                        tank_bullets[b].y = origin_y;
-
-                        // --- AIMING ALGORITHM ---
-                        // Target: Center of Chopper, slightly above (Lead)
-                        int32_t target_x = chopper_world_x + (16 << SUBPIXEL_BITS);
-                        int32_t target_y = chopper_y - AIM_LEAD_Y;
-
-                        // Calculate absolute distances
-                        int32_t dx = labs(target_x - origin_x);
-                        int32_t dy = origin_y - target_y; // Height diff (positive going up)
-
-                        // Clamp dy to avoid divide-by-zero or weirdness if chopper is below tank
-                        if (dy < (16 << SUBPIXEL_BITS)) dy = (16 << SUBPIXEL_BITS);
-
-                        // Select Angle Index based on Slope (dx / dy)
-                        // We use shifts to approximate ratios without division
-                        // 0: dx is very small (< 0.25 dy)
-                        // 1: dx is small (< 0.75 dy)
-                        // 2: dx is medium (< 1.5 dy)
-                        // 3: dx is large (< 3.0 dy)
-                        // 4: dx is very large (Flat)
-                        
-                        int aim_idx = 0;
-                        if (dx < (dy >> 2)) {
-                            aim_idx = 0; // Straight Up
-                        } 
-                        else if (dx < (dy - (dy >> 2))) {
-                            aim_idx = 1; // Steep
-                        }
-                        else if (dx < (dy + (dy >> 1))) {
-                            aim_idx = 2; // Diagonal (45 deg)
-                        }
-                        else if (dx < ((dy << 1) + dy)) { // dy * 3
-                            aim_idx = 3; // Shallow
-                        }
-                        else {
-                            aim_idx = 4; // Low
-                        }
-
-                        // Set Velocity from Lookup Table
-                        tank_bullets[b].vy =  VELOCITY_FACTOR * TANK_AIM_VY[aim_idx];
-                        
-                        // Set Horizontal Velocity (Flip based on direction)
-                        if (target_x > origin_x) {
-                            tank_bullets[b].vx =  VELOCITY_FACTOR * TANK_AIM_VX[aim_idx]; // Fire Right
-                        } else {
-                            tank_bullets[b].vx = -VELOCITY_FACTOR * TANK_AIM_VX[aim_idx]; // Fire Left
-                        }
-
-                        tanks[t].fire_cooldown = 30 + (rand() % 30); // 0.5 - 1 sec cooldown
-
-                        // play_sound(SFX_TYPE_ENEMY_FIRE, 440, PSG_WAVE_TRIANGLE, 0, 4, 3, 3);
-                        sfx_enemy_shoot();
-
-                        break; // Fired!
-                    }
+                // Set Horizontal Velocity (Flip based on direction)
+                if (dir_x > 0) {
+                    tank_bullets[b].vx =  TANK_AIM_VX[aim_idx]; // Fire Right
+                } else {
+                    tank_bullets[b].vx = -TANK_AIM_VX[aim_idx]; // Fire Left
                 }
+
+                tank_cooldown[t] = 30 + rng_below(30); // 0.5 - 1 sec cooldown
+
+                // play_sound(SFX_TYPE_ENEMY_FIRE, 440, PSG_WAVE_TRIANGLE, 0, 4, 3, 3);
+                sfx_enemy_shoot();
             }
         }
     }
 
     // =========================================================
-    // 2. PHYSICS & COLLISION
+    // 2. PHYSICS (hits are handled in ebullet_on_contact)
     // =========================================================
-    for (int b = 0; b < NEBULLET; b++) {
-        unsigned cfg = EBULLET_CONFIG + (b * sizeof(vga_mode4_sprite_t));
-
-        if (!tank_bullets[b].active) {
-            xram0_struct_set(cfg, vga_mode4_sprite_t, y_pos_px, -32);
-            continue;
-        }
+    for (uint8_t k = ebullet_pool.count; k-- > 0; ) {
+        uint8_t b = ebullet_pool.live[k];
+        uint8_t slot = SPR_EBULLET + b;
 
         // --- MOVE ---
         tank_bullets[b].world_x += tank_bullets[b].vx;
         tank_bullets[b].y       += tank_bullets[b].vy;
         tank_bullets[b].vy      += TANK_BULLET_GRAVITY; // Gravity Apply
 
-        // --- PLAYER COLLISION ---
-        if (player_state == PLAYER_ALIVE) {
-            // Chopper Hitbox: +/- 12px width, +/- 8px height
-            // Center is WorldX + 16, Y + 8
-            int32_t chop_cx = chopper_world_x + (16 << SUBPIXEL_BITS);
-            int32_t chop_cy = chopper_y + (8 << SUBPIXEL_BITS);
-
-            if (labs(tank_bullets[b].world_x - chop_cx) < (12 << SUBPIXEL_BITS)) {
-                if (labs(tank_bullets[b].y - chop_cy) < (8 << SUBPIXEL_BITS)) {
-                    
-                    // HIT!
-                    tank_bullets[b].active = false;
-                    xram0_struct_set(cfg, vga_mode4_sprite_t, y_pos_px, -32);
-                    
-                    kill_player();
-                    continue; 
-                }
-            }
-        }
-
-
         // --- GROUND CHECK ---
         // Hit the "Main Ground" (Hostage layer), not the "Tank Ground"
         if (tank_bullets[b].y > EBULLET_GROUND && tank_bullets[b].vy  > 0){
-            tank_bullets[b].active = false;
+            pool_free(&ebullet_pool, b);
+            sprite_hide(slot);
             // Optional: Spawn small explosion on ground
             spawn_small_explosion(tank_bullets[b].world_x, EBULLET_GROUND);
             continue;
         }
 
-        // --- HOSTAGE COLLISION (Cruelty Check) ---
-        // Requirement: Bullet must be FALLING (vy > 0)
-        if (tank_bullets[b].vy > 0) {
-            
-            // Optimization: Only check if bullet is near ground level
-            // Hostages are 16px tall. Check if bullet is in that band.
-            if (tank_bullets[b].y > (EBULLET_GROUND - (20 << SUBPIXEL_BITS))) {
-                
-                for (int h = 0; h < NUM_HOSTAGES; h++) {
-                    // Only check vulnerable hostages
-                    if (hostages[h].state == H_STATE_RUNNING_CHOPPER || 
-                        hostages[h].state == H_STATE_RUNNING_HOME ||
-                        hostages[h].state == H_STATE_WAVING) {
-
-                        // Hitbox check
-                        int32_t host_cx = hostages[h].world_x + (8 << SUBPIXEL_BITS);
-                        int32_t dist = labs(tank_bullets[b].world_x - host_cx);
-
-                        if (dist < (6 << SUBPIXEL_BITS)) { // Direct hit
-                            // Kill Hostage
-                            int32_t host_cx = hostages[h].world_x + (8 << SUBPIXEL_BITS);
-                            hostages[h].state = H_STATE_DYING;
-                            spawn_small_explosion(host_cx, hostages[h].y + (8<<SUBPIXEL_BITS));
-                            sfx_hostage_die();
-                            
-                            // Destroy Bullet
-                            tank_bullets[b].active = false;
-                            break; 
-                        }
-                    }
-                }
-                if (!tank_bullets[b].active) continue; // Bullet died, next bullet
-            }
-        }
-
         // --- RENDER ---
-        int32_t screen_sub = tank_bullets[b].world_x - camera_x;
-        int16_t screen_px = screen_sub >> SUBPIXEL_BITS;
+        int16_t screen_px = SCREEN_PX16(tank_bullets[b].world_x);
 
         if (screen_px > -30 && screen_px < 370) {
-            xram0_struct_set(cfg, vga_mode4_sprite_t, x_pos_px, screen_px);
-            xram0_struct_set(cfg, vga_mode4_sprite_t, y_pos_px, tank_bullets[b].y >> SUBPIXEL_BITS);
+            sprite_show(slot, screen_px, Y_PX(tank_bullets[b].y));
+
+            // Hits the chopper anywhere
+            collision_add(COL_EBULLET, b, tank_bullets[b].world_x, tank_bullets[b].y);
+
+            // Hostages only on the way down, close to the ground (Cruelty Check)
+            if (tank_bullets[b].vy > 0 &&
+                tank_bullets[b].y > (EBULLET_GROUND - (20 << SUBPIXEL_BITS_Y))) {
+                collision_add(COL_EBULLET_LOW, b, tank_bullets[b].world_x, tank_bullets[b].y);
+            }
         } else {
             // Off-screen = Deactivate to save slots
-            tank_bullets[b].active = false;
-            xram0_struct_set(cfg, vga_mode4_sprite_t, y_pos_px, -32);
+            pool_free(&ebullet_pool, b);
+            sprite_hide(slot);
         }
     }
 }
 
+// Called by collision_run() for each chopper/hostage a tank bullet touched
+void ebullet_on_contact(uint8_t b, const Collider *target) {
+    if (!pool_is_live(&ebullet_pool, b)) return;
 
+    if (target->type == COL_CHOPPER) {
+        if (player_state != PLAYER_ALIVE) return;
+
+        // HIT!
+        kill_player();
+    }
+    else if (target->type == COL_HOSTAGE) {
+        uint8_t h = target->index;
+        if (hostage_state[h] == H_STATE_DYING) return;
+
+        // Kill Hostage
+        WorldX16 host_cx = hostage_x[h] + (8 << SUBPIXEL_BITS);
+        hostage_state[h] = H_STATE_DYING;
+        spawn_small_explosion(host_cx, hostage_y[h] + (8 << SUBPIXEL_BITS_Y));
+        sfx_hostage_die();
+    }
+    else {
+        return;
+    }
+
+    // Destroy Bullet
+    pool_free(&ebullet_pool, b);
+    sprite_hide(SPR_EBULLET + b);
+}
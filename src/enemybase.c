@@ -5,6 +5,9 @@
 #include "player.h"
 #include "enemybase.h"
 #include "hostages.h"
+#include "sprites.h"
+#include "collision.h"
+#include "world.h"
 
 // World X locations for the 4 bases (Subpixels)
 // Spread them out: 500, 1500, 2500, 3500
@@ -15,59 +18,87 @@ int32_t ENEMY_BASE_LOCATIONS[NUM_ENEMY_BASES] = {
     3200L << SUBPIXEL_BITS
 };
 
-void update_enemybase(void) {
+// What each pair of sprites shows now, so a still camera costs nothing
+static bool    pair_shown[ENEMYBASES_ON_SCREEN];
+static int16_t drawn_scroll[ENEMYBASES_ON_SCREEN];     // world.scroll_px
+static uint8_t drawn_base[ENEMYBASES_ON_SCREEN];
+static bool    drawn_destroyed[ENEMYBASES_ON_SCREEN];
+
+// Put base i in sprite pair p (no-op if the pair already shows it there)
+static void draw_base(uint8_t p, uint8_t i)
+{
     const int16_t BASE_Y = GROUND_Y - 16;
+    uint8_t slot = SPR_ENEMYBASE + (p * 2);
+    bool destroyed = base_state[i].destroyed;
+
+    // Same base, same state, camera on the same pixel: sprites are right
+    if (pair_shown[p] && i == drawn_base[p] && destroyed == drawn_destroyed[p] &&
+        world.scroll_px == drawn_scroll[p]) {
+        return;
+    }
+    pair_shown[p] = true;
+    drawn_base[p] = i;
+    drawn_destroyed[p] = destroyed;
+    drawn_scroll[p] = world.scroll_px;
 
-    bool visible_base_found = false;
+    int16_t screen_px = (int16_t)(ENEMY_BASE_LOCATIONS[i] >> SUBPIXEL_BITS) + world.scroll_px;
 
-    for (int i = 0; i < NUM_ENEMY_BASES; i++) {
-        int32_t world_x = ENEMY_BASE_LOCATIONS[i];
-        int32_t screen_sub = world_x - camera_x;
-        int16_t screen_px  = screen_sub >> SUBPIXEL_BITS;
+    // --- CALCULATE POINTERS ---
+    // 32x32 sprite = 2048 bytes.
+    // Index 0 (Left Intact)  = ENEMYBASE_DATA
+    // Index 1 (Right Intact) = ENEMYBASE_DATA + 2048
+    // Index 2 (Left Ruined)  = ENEMYBASE_DATA + 4096
+    
+    uint16_t ptr_left;
+    uint16_t ptr_right;
 
-        // Visibility Check
-        if (screen_px > -64 && screen_px < 320) {
-            
-            // --- CALCULATE POINTERS ---
-            // 32x32 sprite = 2048 bytes.
-            // Index 0 (Left Intact)  = ENEMYBASE_DATA
-            // Index 1 (Right Intact) = ENEMYBASE_DATA + 2048
-            // Index 2 (Left Ruined)  = ENEMYBASE_DATA + 4096
-            
-            uint16_t ptr_left;
-            uint16_t ptr_right;
+    if (destroyed) {
+        // Destroyed: Left uses Index 2, Right keeps Index 1
+        ptr_left  = (uint16_t)(ENEMYBASE_DATA + 4096); 
+        ptr_right = (uint16_t)(ENEMYBASE_DATA + 2048); 
+    } else {
+        // Intact: Left uses Index 0, Right uses Index 1
+        ptr_left  = (uint16_t)(ENEMYBASE_DATA);
+        ptr_right = (uint16_t)(ENEMYBASE_DATA + 2048);
+    }
 
-            if (base_state[i].destroyed) {
-                // Destroyed: Left uses Index 2, Right keeps Index 1
-                ptr_left  = (uint16_t)(ENEMYBASE_DATA + 4096); 
-                ptr_right = (uint16_t)(ENEMYBASE_DATA + 2048); 
-            } else {
-                // Intact: Left uses Index 0, Right uses Index 1
-                ptr_left  = (uint16_t)(ENEMYBASE_DATA);
-                ptr_right = (uint16_t)(ENEMYBASE_DATA + 2048);
-            }
+    // --- UPDATE HARDWARE ---
+    
+    // Left Sprite
+    sprite_show(slot, screen_px, BASE_Y);
+    sprite_set(slot, xram_sprite_ptr, ptr_left);
 
-            // --- UPDATE HARDWARE ---
-            
-            // Left Sprite
-            unsigned cfg_left = ENEMYBASE_CONFIG;
-            xram0_struct_set(cfg_left, vga_mode4_sprite_t, x_pos_px, screen_px);
-            xram0_struct_set(cfg_left, vga_mode4_sprite_t, y_pos_px, BASE_Y);
-            xram0_struct_set(cfg_left, vga_mode4_sprite_t, xram_sprite_ptr, ptr_left);
+    // Right Sprite
+    sprite_show(slot + 1, (screen_px + 32), BASE_Y);
+    sprite_set(slot + 1, xram_sprite_ptr, ptr_right);
+}
 
-            // Right Sprite
-            unsigned cfg_right = ENEMYBASE_CONFIG + sizeof(vga_mode4_sprite_t);
-            xram0_struct_set(cfg_right, vga_mode4_sprite_t, x_pos_px, (screen_px + 32));
-            xram0_struct_set(cfg_right, vga_mode4_sprite_t, y_pos_px, BASE_Y);
-            xram0_struct_set(cfg_right, vga_mode4_sprite_t, xram_sprite_ptr, ptr_right);
+void update_enemybase(void) {
+    uint8_t p = 0;
 
-            visible_base_found = true;
-            break;
+    // Only the bases overlapping the screen need drawing or a door hitbox;
+    // update_world_view() already listed them, left to right
+    for (uint8_t k = 0; k < world.in_view_count; k++) {
+        const Structure *s = &world_structures[world.in_view[k]];
+        if (s->kind != STRUCT_ENEMY_BASE) continue;
+
+        uint8_t i = s->index;
+
+        // Door hitbox for player bullets (registered afresh every frame)
+        if (!base_state[i].destroyed) {
+            collision_add(COL_BASE, i, WORLD_X16(ENEMY_BASE_LOCATIONS[i]), GROUND_Y_SUB);
+        }
+
+        if (p < ENEMYBASES_ON_SCREEN) {
+            draw_base(p++, i);
         }
     }
 
-    if (!visible_base_found) {
-        xram0_struct_set(ENEMYBASE_CONFIG, vga_mode4_sprite_t, y_pos_px, -32);
-        xram0_struct_set(ENEMYBASE_CONFIG + sizeof(vga_mode4_sprite_t), vga_mode4_sprite_t, y_pos_px, -32);
+    // Pairs with nothing to show
+    for (; p < ENEMYBASES_ON_SCREEN; p++) {
+        if (pair_shown[p]) {
+            sprite_hide_range(SPR_ENEMYBASE + (p * 2), 2);
+            pair_shown[p] = false;
+        }
     }
-}
\ No newline at end of file
+}
@@ -2,7 +2,8 @@
 #define ENEMYBASE_H
 
 // Enemy Base
-#define NUM_ENEMYBASE_SPRITE   2  // 2x 32x32 sprites (top and bottom)
+#define ENEMYBASES_ON_SCREEN   1  // Bases drawn at once (they are ~1000px apart)
+#define NUM_ENEMYBASE_SPRITE   (2 * ENEMYBASES_ON_SCREEN)  // 2x 32x32 sprites (left and right) each
 
 #define NUM_ENEMY_BASES 4
 
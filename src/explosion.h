@@ -1,7 +1,7 @@
 #ifndef EXPLOSION_H
 #define EXPLOSION_H
 
-extern void trigger_explosion(int32_t x, int16_t y);
+extern void trigger_explosion(int32_t x, int32_t y);
 extern void update_explosion(void);
 
 #endif // EXPLOSION_H
\ No newline at end of file
@@ -4,26 +4,30 @@
 #include "player.h"
 #include "homebase.h"
 #include "flags.h"
+#include "sprites.h"
+#include "world.h"
+#include "anim.h"
+#include "luts.h"
 
 
-static uint8_t flag_anim_timer = 0;
-static uint8_t flag_frame_idx = 0;
+static AnimCursor flag_anim;
+static int16_t flag_drawn_scroll = WORLD_NOT_DRAWN;   // world.scroll_px last placed for
 
 void update_flags(void) {
     // ---------------------------------------------------
     // 1. ANIMATION LOGIC
     // ---------------------------------------------------
-    // Toggle frame every 10 ticks (approx 6 times a second)
-    flag_anim_timer++;
-    if (flag_anim_timer > 10) {
-        flag_anim_timer = 0;
-        flag_frame_idx = !flag_frame_idx; // Toggle 0 -> 1 -> 0
+    // Two frames, about 5 flaps a second (ANIM_FLAG)
+    if (!flag_anim.clip) {
+        anim_restart(&flag_anim, &ANIM_FLAG);
+    }
+    if (anim_step(&flag_anim) == ANIM_CHANGED) {
+        sprite_set(SPR_FLAGS, xram_sprite_ptr, anim_cell(&flag_anim));
     }
 
-    // Calculate Data Pointer based on frame
-    // Frame 0 = Offset 0
-    // Frame 1 = Offset 512 (16x16 pixels * 2 bytes)
-    uint16_t current_sprite_ptr = FLAGS_DATA + (flag_frame_idx * 512);
+    // The pole doesn't move: only re-place it when the camera moved a pixel
+    if (world.scroll_px == flag_drawn_scroll) return;
+    flag_drawn_scroll = world.scroll_px;
 
     // ---------------------------------------------------
     // 2. POSITIONING
@@ -42,20 +46,15 @@ void update_flags(void) {
     // ---------------------------------------------------
     // 3. SCREEN CALC & UPDATE
     // ---------------------------------------------------
-    int32_t screen_x_sub = flag_world_x - camera_x;
-    int16_t screen_x_px  = screen_x_sub >> SUBPIXEL_BITS;
+    int16_t screen_x_px = (int16_t)(flag_world_x >> SUBPIXEL_BITS) + world.scroll_px;
 
     // Check Visibility
-    if (screen_x_px > -16 && screen_x_px < 336) {
+    if (ON_SCREEN(screen_x_px, 16)) {
         // Update Position
-        xram0_struct_set(FLAGS_CONFIG, vga_mode4_sprite_t, x_pos_px, screen_x_px);
-        xram0_struct_set(FLAGS_CONFIG, vga_mode4_sprite_t, y_pos_px, FLAG_Y);
-        
-        // Update Animation Frame
-        xram0_struct_set(FLAGS_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, current_sprite_ptr);
+        sprite_show(SPR_FLAGS, screen_x_px, FLAG_Y);
     } 
     else {
         // Hide
-        xram0_struct_set(FLAGS_CONFIG, vga_mode4_sprite_t, y_pos_px, -32);
+        sprite_hide(SPR_FLAGS);
     }
 }
\ No newline at end of file
@@ -0,0 +1,59 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "framestats.h"
+
+// Same order as GameState in main.c
+static const char *const state_names[] = { "TITLE", "PLAYING", "GAME OVER" };
+#define STATE_NAME_COUNT (sizeof(state_names) / sizeof(state_names[0]))
+
+static uint32_t frames_run = 0;      // Main loop iterations
+static uint32_t frames_missed = 0;   // Vsyncs we slept through
+static uint16_t late_iterations = 0; // Iterations that missed at least one
+
+static uint8_t worst_gap = 0;        // Most vsyncs missed in one iteration
+static uint8_t worst_gap_state = 0;
+
+static uint16_t streak = 0;          // Current run of late iterations
+static uint16_t worst_streak = 0;
+static uint8_t worst_streak_state = 0;
+
+static const char *state_name(uint8_t state)
+{
+    return (state < STATE_NAME_COUNT) ? state_names[state] : "?";
+}
+
+// vsync_delta is RIA.vsync now minus RIA.vsync at the previous iteration
+// (uint8_t arithmetic, so the counter wrapping is fine). 1 is on time.
+void frame_stats_update(uint8_t vsync_delta, uint8_t state)
+{
+    frames_run++;
+
+    if (vsync_delta <= 1) {
+        streak = 0;
+        return;
+    }
+
+    uint8_t missed = vsync_delta - 1;
+    frames_missed += missed;
+    late_iterations++;
+
+    if (missed > worst_gap) {
+        worst_gap = missed;
+        worst_gap_state = state;
+    }
+
+    if (++streak > worst_streak) {
+        worst_streak = streak;
+        worst_streak_state = state;
+    }
+}
+
+void frame_stats_report(void)
+{
+    printf("FRAMES %lu run, %lu missed, %u late\n",
+           (unsigned long)frames_run, (unsigned long)frames_missed, late_iterations);
+    printf("FRAMES worst gap %u (%s), worst streak %u (%s)\n",
+           worst_gap, state_name(worst_gap_state),
+           worst_streak, state_name(worst_streak_state));
+}
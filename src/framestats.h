@@ -0,0 +1,27 @@
+#ifndef FRAMESTATS_H
+#define FRAMESTATS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ============================================================================
+// FRAME PACING STATISTICS
+// ============================================================================
+// The main loop runs once per vsync. When an iteration overruns, RIA.vsync
+// has moved on by more than one when we next look at it, and the game just
+// runs slower for that frame. frame_stats_update() is handed that delta
+// every iteration and keeps:
+//   - frames run and frames missed since boot
+//   - the worst gap (most vsyncs missed by a single iteration)
+//   - the worst streak (most consecutive iterations that each missed one)
+// and for the worst gap/streak, which game_state it happened in.
+//
+// Press FRAME_STATS_KEY at any time to print them over the console UART;
+// they are also printed on exit (ESC).
+
+#define FRAME_STATS_KEY KEY_F9   // From constants.h
+
+extern void frame_stats_update(uint8_t vsync_delta, uint8_t state);
+extern void frame_stats_report(void);
+
+#endif // FRAMESTATS_H
@@ -15,7 +15,7 @@ HighScoreEntry todays_best;
 void draw_repeat_char(uint8_t x, uint8_t y, uint8_t count, uint8_t ch, uint8_t color) {
     for(int i=0; i<count; i++) {
         // We can use a simplified draw_text logic here or construct a 1-char string
-        char buf[2] = {ch, 0};
+        char buf[2] = {(char)ch, 0};
         draw_text(x + i, y, buf, color);
     }
 }
@@ -220,7 +220,7 @@ void draw_high_score_screen(void) {
         if (y > 13) break; // Safety
 
         // Rank (1, 2, 3...)
-        char rank[2] = {'1' + i, 0};
+        char rank[2] = {(char)('1' + i), 0};
         draw_text(21, y, rank, HUD_COL_CYAN);
 
         // Name
@@ -248,10 +248,6 @@ void enter_initials(uint8_t saved, uint8_t lost) {
     uint8_t cursor = 0;
     uint8_t vsync_last = RIA.vsync;
     
-    bool up_prev = false;
-    bool down_prev = false;
-    bool fire_prev = false;
-    
     // Input Loop
     while (cursor < 3) {
         if (RIA.vsync == vsync_last) continue;
@@ -280,29 +276,25 @@ void enter_initials(uint8_t saved, uint8_t lost) {
         // 2. Handle Input
         // Read Gamepad 0
         handle_input();
-        bool up = is_action_pressed(0, ACTION_THRUST);
-        bool down = is_action_pressed(0, ACTION_REVERSE_THRUST);
-        bool fire = is_action_pressed(0, ACTION_FIRE) || is_action_pressed(0, ACTION_PAUSE); // Start or Fire
+        bool up = is_action_just_pressed(0, ACTION_THRUST);
+        bool down = is_action_just_pressed(0, ACTION_REVERSE_THRUST);
+        bool fire = (action_pressed[0] & (ACTION_BIT(ACTION_FIRE) | ACTION_BIT(ACTION_PAUSE))) != 0; // Start or Fire
 
         // UP
-        if (up && !up_prev) {
+        if (up) {
             name[cursor]++;
             if (name[cursor] > 'Z') name[cursor] = 'A';
         }
         // DOWN
-        if (down && !down_prev) {
+        if (down) {
             name[cursor]--;
             if (name[cursor] < 'A') name[cursor] = 'Z';
         }
         // ENTER
-        if (fire && !fire_prev) {
+        if (fire) {
             cursor++;
         }
 
-        up_prev = up;
-        down_prev = down;
-        fire_prev = fire;
-
         update_music();
 
     }
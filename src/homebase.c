@@ -3,13 +3,22 @@
 #include "constants.h"
 #include "player.h"
 #include "homebase.h"
+#include "sprites.h"
+#include "world.h"
+
+// world.scroll_px the base was last placed for
+static int16_t homebase_drawn_scroll = WORLD_NOT_DRAWN;
 
 void update_homebase(void) {
+    // Static building: nothing to do unless the camera moved a pixel
+    if (world.scroll_px == homebase_drawn_scroll) return;
+    homebase_drawn_scroll = world.scroll_px;
+
     // Bottom row sits ON the ground (16px high)
     const int16_t ROW0_Y = GROUND_Y; 
     
     for (int i = 0; i < NUM_HOMEBASE_SPRITE; i++) {
-        unsigned cfg_addr = HOMEBASE_CONFIG + (i * sizeof(vga_mode4_sprite_t));
+        uint8_t slot = SPR_HOMEBASE + i;
 
         // ---------------------------------------------------
         // 1. CALCULATE LAYOUT
@@ -33,16 +42,14 @@ void update_homebase(void) {
         // ---------------------------------------------------
         // 2. POSITION & CULL
         // ---------------------------------------------------
-        int32_t sprite_world_x = HOMEBASE_WORLD_X + (offset_x_px << SUBPIXEL_BITS);
-        int32_t screen_x_sub   = sprite_world_x - camera_x;
-        int16_t screen_x_px    = screen_x_sub >> SUBPIXEL_BITS;
+        int16_t screen_x_px = (int16_t)(HOMEBASE_WORLD_X >> SUBPIXEL_BITS)
+                            + offset_x_px + world.scroll_px;
 
-        if (screen_x_px > -16 && screen_x_px < 336) {
-            xram0_struct_set(cfg_addr, vga_mode4_sprite_t, x_pos_px, screen_x_px);
-            xram0_struct_set(cfg_addr, vga_mode4_sprite_t, y_pos_px, (ROW0_Y + offset_y_px));
+        if (ON_SCREEN(screen_x_px, 16)) {
+            sprite_show(slot, screen_x_px, (ROW0_Y + offset_y_px));
         } 
         else {
-            xram0_struct_set(cfg_addr, vga_mode4_sprite_t, y_pos_px, -32);
+            sprite_hide(slot);
         }
     }
 }
\ No newline at end of file
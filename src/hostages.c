@@ -10,9 +10,21 @@
 #include "smallexplosion.h"
 #include "sound.h"
 #include "input.h"
-
-
-Hostage hostages[NUM_HOSTAGES];
+#include "sprites.h"
+#include "collision.h"
+#include "world.h"
+#include "luts.h"
+
+
+uint8_t  hostage_state[NUM_HOSTAGES] ZEROPAGE;
+WorldX16 hostage_x[NUM_HOSTAGES];
+uint16_t hostage_y[NUM_HOSTAGES];
+int8_t   hostage_dir[NUM_HOSTAGES];
+AnimCursor hostage_anim[NUM_HOSTAGES];
+uint8_t  hostage_timer[NUM_HOSTAGES];
+uint8_t  hostage_base[NUM_HOSTAGES];
+Pool     hostage_pool;
+_Static_assert(NUM_HOSTAGES <= POOL_MAX_SLOTS, "raise POOL_MAX_SLOTS");
 
 // Gameplay Counters
 uint8_t hostages_on_board = 0;
@@ -28,22 +40,143 @@ uint8_t hostages_lost_count = 0;
 #define CHOPPER_WIDTH_SUB   (32 << SUBPIXEL_BITS) 
 #define CRUSH_WIDTH_SUB     (28 << SUBPIXEL_BITS) // Slightly narrower than full width
 
-#define SIGHT_HEIGHT ((GROUND_Y_SUB - (64<<SUBPIXEL_BITS)))
+#define SIGHT_HEIGHT ((GROUND_Y_SUB - (64 << SUBPIXEL_BITS_Y)))
 
 EnemyBase base_state[NUM_ENEMY_BASES]; // We track state for the 4 bases
 
-// Helper to get sprite data offset
-uint16_t get_hostage_ptr(int frame_idx) {
-    return HOSTAGES_DATA + (frame_idx * 512);
+// =========================================================
+// CROWD LIST
+// =========================================================
+// Every hostage standing on the ground (anything but INACTIVE, ON_BOARD and
+// SAFE) is kept in crowd[], sorted by world_x. Hostages only move one step
+// per frame, so after each move one or two insertion swaps put the list
+// back in order. The spacing and door checks then only walk the immediate
+// neighbours instead of every hostage.
+//
+// Hostages never leave the world, so their 16-bit world_x compare directly
+// (no WORLD_DX16 needed) and the gap to a later neighbour is never negative.
+//
+// Hostages leave the ground from several places (boarding, rescue, bullets
+// finishing them off), so instead of hooking all of them crowd_prune()
+// drops stale entries once at the top of update_hostages().
+// init_game_logic() empties the list with reset_hostage_crowd().
+
+#define CROWD_NONE      0xFF
+#define HOSTAGE_SPACING (12 << SUBPIXEL_BITS)  // Keep this far from the next man
+#define DOOR_BLOCK_DIST (8 << SUBPIXEL_BITS)   // Door is blocked within this of spawn_x
+
+static uint8_t crowd[NUM_HOSTAGES];       // Hostage slots, ascending world_x
+static uint8_t crowd_count = 0;
+static uint8_t crowd_pos[NUM_HOSTAGES];   // Index in crowd[] (CROWD_NONE if absent)
+
+// s is a HostageState, passed as stored in hostage_state[]
+static bool hostage_on_ground(uint8_t s) {
+    return s != H_STATE_INACTIVE && s != H_STATE_ON_BOARD && s != H_STATE_SAFE;
+}
+
+// Others keep their distance from these (the dying and waving don't count)
+static bool hostage_takes_space(uint8_t s) {
+    return hostage_on_ground(s) && s != H_STATE_DYING && s != H_STATE_WAVING;
+}
+
+static void crowd_swap(uint8_t a, uint8_t b) {
+    uint8_t t = crowd[a];
+    crowd[a] = crowd[b];
+    crowd[b] = t;
+    crowd_pos[crowd[a]] = a;
+    crowd_pos[crowd[b]] = b;
+}
+
+// Move hostage h to its sorted place after its world_x changed
+static void crowd_settle(uint8_t h) {
+    uint8_t p = crowd_pos[h];
+    WorldX16 x = hostage_x[h];
+
+    while (p > 0 && hostage_x[crowd[p - 1]] > x) {
+        crowd_swap(p - 1, p);
+        p--;
+    }
+    while (p + 1 < crowd_count && hostage_x[crowd[p + 1]] < x) {
+        crowd_swap(p, p + 1);
+        p++;
+    }
+}
+
+static void crowd_add(uint8_t h) {
+    if (crowd_pos[h] != CROWD_NONE) return;
+    crowd[crowd_count] = h;
+    crowd_pos[h] = crowd_count++;
+    crowd_settle(h);
+}
+
+// Drop everyone who is no longer on the ground, keeping the order
+static void crowd_prune(void) {
+    uint8_t n = 0;
+    for (uint8_t k = 0; k < crowd_count; k++) {
+        uint8_t h = crowd[k];
+        if (hostage_on_ground(hostage_state[h])) {
+            crowd[n] = h;
+            crowd_pos[h] = n++;
+        } else {
+            crowd_pos[h] = CROWD_NONE;
+        }
+    }
+    crowd_count = n;
+}
+
+// Is there someone within HOSTAGE_SPACING ahead of h in direction dir?
+static bool crowd_blocked(uint8_t h, int8_t dir) {
+    WorldX16 x = hostage_x[h];
+    uint8_t p = crowd_pos[h];
+
+    if (dir > 0) {
+        for (uint8_t k = p + 1; k < crowd_count; k++) {
+            uint8_t o = crowd[k];
+            uint16_t sep = hostage_x[o] - x;
+            if (sep >= HOSTAGE_SPACING) break;
+            if (sep > 0 && hostage_takes_space(hostage_state[o])) return true;
+        }
+    } else {
+        for (uint8_t k = p; k-- > 0; ) {
+            uint8_t o = crowd[k];
+            uint16_t sep = x - hostage_x[o];
+            if (sep >= HOSTAGE_SPACING) break;
+            if (sep > 0 && hostage_takes_space(hostage_state[o])) return true;
+        }
+    }
+    return false;
+}
+
+// Anyone on the ground with their centre (world_x + 8px) near spawn_x?
+static bool door_is_blocked(WorldX16 spawn_x) {
+    WorldX16 lo = spawn_x - DOOR_BLOCK_DIST - (8 << SUBPIXEL_BITS);  // Exclusive
+    WorldX16 hi = spawn_x + DOOR_BLOCK_DIST - (8 << SUBPIXEL_BITS);  // Exclusive
+
+    // Binary search for the first hostage with world_x > lo
+    uint8_t first = 0, last = crowd_count;
+    while (first < last) {
+        uint8_t mid = (first + last) >> 1;
+        if (hostage_x[crowd[mid]] > lo) last = mid;
+        else first = mid + 1;
+    }
+
+    return first < crowd_count && hostage_x[crowd[first]] < hi;
+}
+
+void reset_hostage_crowd(void) {
+    crowd_count = 0;
+    for (uint8_t h = 0; h < NUM_HOSTAGES; h++) crowd_pos[h] = CROWD_NONE;
 }
 
 void kill_all_passengers(void) {
-    for (int i = 0; i < NUM_HOSTAGES; i++) {
+    for (uint8_t k = hostage_pool.count; k-- > 0; ) {
+        uint8_t i = hostage_pool.live[k];
         // If they are on board (or mid-boarding), they die
-        if (hostages[i].state == H_STATE_ON_BOARD || 
-            hostages[i].state == H_STATE_BOARDING) {
+        if (hostage_state[i] == H_STATE_ON_BOARD || 
+            hostage_state[i] == H_STATE_BOARDING) {
             
-            hostages[i].state = H_STATE_INACTIVE;
+            hostage_state[i] = H_STATE_INACTIVE;
+            pool_free(&hostage_pool, i);
             
             // Note: We don't spawn explosions here because they are inside 
             // the chopper, which is already exploding.
@@ -59,14 +192,22 @@ void update_hostages(void) {
     
     // --- 1. PRE-CALCULATE CHOPPER STATE ---
     bool is_chopper_landed = (chopper_y >= GROUND_Y_SUB);
-    bool is_chopper_low = (chopper_y > (GROUND_Y_SUB - (14 << SUBPIXEL_BITS)));
-    int32_t chopper_center_x = chopper_world_x + (16 << SUBPIXEL_BITS);
-
-    int32_t crush_threshold = (current_heading == FACING_CENTER) ? (8<<4) : (15<<4);
+    bool is_chopper_low = (chopper_y > (GROUND_Y_SUB - (14 << SUBPIXEL_BITS_Y)));
+    WorldX16 chopper_center_x = world.chopper_x16 + (16 << SUBPIXEL_BITS);
 
     // Check if player is trying to take off
     bool is_taking_off = is_action_pressed(0, ACTION_THRUST);
 
+    // Forget hostages that boarded, got home or died since last frame
+    crowd_prune();
+
+    // Skids low over the crowd squash anyone underneath (hostage_on_crush).
+    // Facing the screen the skids are narrower.
+    if (is_chopper_low && !is_chopper_landed && !is_taking_off) {
+        collision_add((current_heading == FACING_CENTER) ? COL_CRUSH_CENTER : COL_CRUSH_SIDE,
+                      0, world.chopper_x16, chopper_y);
+    }
+
     // =========================================================
     // 1. SPAWN LOGIC
     // =========================================================
@@ -81,39 +222,25 @@ void update_hostages(void) {
                 // int32_t variance = (rand() % 16) << SUBPIXEL_BITS;
                 // int32_t spawn_x = ENEMY_BASE_LOCATIONS[i] + (8 << SUBPIXEL_BITS) + variance;
 
-                bool door_blocked = false;
-                int32_t spawn_x = ENEMY_BASE_LOCATIONS[i] + (13 << SUBPIXEL_BITS);
-
-                for (int h = 0; h < NUM_HOSTAGES; h++) {
-                    if (hostages[h].state != H_STATE_INACTIVE && 
-                        hostages[h].state != H_STATE_ON_BOARD && 
-                        hostages[h].state != H_STATE_SAFE) {
-                        
-                        int32_t h_cx = hostages[h].world_x + (8 << SUBPIXEL_BITS);
-                        
-                        // REDUCED BLOCK RADIUS:
-                        // Changed from 12 to 8. Allows tighter packing at the door.
-                        if (labs(h_cx - spawn_x) < (8 << SUBPIXEL_BITS)) {
-                            door_blocked = true;
-                            break;
-                        }
-                    }
-                }
+                WorldX16 spawn_x = WORLD_X16(ENEMY_BASE_LOCATIONS[i] + (13 << SUBPIXEL_BITS));
+
+                // REDUCED BLOCK RADIUS:
+                // Changed from 12 to 8. Allows tighter packing at the door.
+                bool door_blocked = door_is_blocked(spawn_x);
 
                 if (!door_blocked) {
                     base_state[i].spawn_timer = 0;
-                    for (int h = 0; h < NUM_HOSTAGES; h++) {
-                        if (hostages[h].state == H_STATE_INACTIVE) {
-                            hostages[h].state = H_STATE_RUNNING_CHOPPER;
-                            hostages[h].base_id = i;
-                            hostages[h].world_x = spawn_x;
-                            hostages[h].y = GROUND_Y_SUB + (4 << SUBPIXEL_BITS);
-                            hostages[h].anim_frame = 8;
-                            hostages[h].direction = 0;
-                            base_state[i].hostages_remaining--;
-                            hostages_total_spawned++;
-                            break;
-                        }
+                    uint8_t h = pool_alloc(&hostage_pool);
+                    if (h != POOL_NONE) {
+                        hostage_state[h] = H_STATE_RUNNING_CHOPPER;
+                        hostage_base[h] = i;
+                        hostage_x[h] = spawn_x;
+                        hostage_y[h] = GROUND_Y_SUB + (4 << SUBPIXEL_BITS_Y);
+                        anim_restart(&hostage_anim[h], &ANIM_HOSTAGE_IDLE);
+                        hostage_dir[h] = 0;
+                        crowd_add(h);
+                        base_state[i].hostages_remaining--;
+                        hostages_total_spawned++;
                     }
                 }
             }
@@ -136,11 +263,13 @@ void update_hostages(void) {
         dropoff_timer++;
         if (dropoff_timer > 30) { 
             dropoff_timer = 0;
-            for (int h = 0; h < NUM_HOSTAGES; h++) {
-                if (hostages[h].state == H_STATE_ON_BOARD) {
-                    hostages[h].state = H_STATE_RUNNING_HOME;
-                    hostages[h].world_x = chopper_center_x; 
-                    hostages[h].base_id = (hostages_on_board == 1) ? 99 : 0; 
+            for (uint8_t k = 0; k < hostage_pool.count; k++) {
+                uint8_t h = hostage_pool.live[k];
+                if (hostage_state[h] == H_STATE_ON_BOARD) {
+                    hostage_state[h] = H_STATE_RUNNING_HOME;
+                    hostage_x[h] = chopper_center_x; 
+                    hostage_base[h] = (hostages_on_board == 1) ? 99 : 0; 
+                    crowd_add(h);
                     hostages_on_board--;
                     break;
                 }
@@ -151,43 +280,36 @@ void update_hostages(void) {
     // =========================================================
     // 3. HOSTAGE LOOP
     // =========================================================
-    for (int i = 0; i < NUM_HOSTAGES; i++) {
-        unsigned cfg = HOSTAGE_CONFIG + (i * sizeof(vga_mode4_sprite_t));
+    // Live slots only (see pool.h for why it runs backwards)
+    for (uint8_t k = hostage_pool.count; k-- > 0; ) {
+        uint8_t i = hostage_pool.live[k];
+        uint8_t slot = SPR_HOSTAGE + i;
 
-        if (hostages[i].state == H_STATE_INACTIVE || 
-            hostages[i].state == H_STATE_ON_BOARD || 
-            hostages[i].state == H_STATE_SAFE) {
+        if (hostage_state[i] == H_STATE_ON_BOARD || 
+            hostage_state[i] == H_STATE_SAFE) {
             continue; 
         }
 
-        if (hostages[i].state == H_STATE_DYING) {
+        if (hostage_state[i] == H_STATE_DYING) {
             hostages_lost_count++;
-            hostages[i].state = H_STATE_INACTIVE;
-            xram0_struct_set(cfg, vga_mode4_sprite_t, y_pos_px, -32);
+            hostage_state[i] = H_STATE_INACTIVE;
+            pool_free(&hostage_pool, i);
+            sprite_hide(slot);
             continue;
         }
 
-        if (is_chopper_low && !is_chopper_landed && !is_taking_off) {
-            int32_t host_cx = hostages[i].world_x + (8 << SUBPIXEL_BITS);
-            int32_t dist = labs(chopper_center_x - host_cx);
-            if (dist < crush_threshold) {
-                hostages[i].state = H_STATE_DYING;
-                spawn_small_explosion(host_cx, hostages[i].y + (8<<4));
-                sfx_hostage_die();
-                continue; 
-            }
-        }
-
         // --- TARGET SELECTION ---
-        int32_t target_x = hostages[i].world_x;
+        WorldX16 target_x = hostage_x[i];
         bool is_moving_state = false;
 
-        if (hostages[i].state == H_STATE_RUNNING_CHOPPER) {
-            // Calculate distance to chopper
-            int32_t dist_to_chopper = labs(chopper_center_x - hostages[i].world_x);
+        if (hostage_state[i] == H_STATE_RUNNING_CHOPPER) {
+            // Calculate distance to chopper. 16-bit distances alias past
+            // 2048px, so only hostages of the base the chopper is at look.
+            int16_t dist_to_chopper = abs(WORLD_DX16(chopper_center_x, hostage_x[i]));
             
             // Check if Chopper is visible (Landed/Low AND Close)
-            bool can_see = (chopper_y >= SIGHT_HEIGHT) && (dist_to_chopper < SIGHT_RANGE);
+            bool can_see = (chopper_y >= SIGHT_HEIGHT) && (dist_to_chopper < SIGHT_RANGE) &&
+                           (hostage_base[i] == world.closest_base);
 
             if (can_see) {
                 // Run to Chopper
@@ -197,23 +319,24 @@ void update_hostages(void) {
                 // Spread them out more so they don't cluster.
                 // Modulo 8 allows 8 distinct "waiting spots".
                 // Spread: -56 to +56 pixels.
-                int32_t base_x = ENEMY_BASE_LOCATIONS[hostages[i].base_id];
+                WorldX16 base_x = WORLD_X16(ENEMY_BASE_LOCATIONS[hostage_base[i]]);
                 // Scatter offset: -24, -8, +8, +24
-                int32_t wander = ((i % 4) * 16 - 24) << SUBPIXEL_BITS;
+                int16_t wander = ((i % 4) * 16 - 24) << SUBPIXEL_BITS;
                 target_x = base_x + wander;
             }
             is_moving_state = true;
         }
-        else if (hostages[i].state == H_STATE_RUNNING_HOME) {
-            target_x = HOMEBASE_WORLD_X + (24 << SUBPIXEL_BITS);
+        else if (hostage_state[i] == H_STATE_RUNNING_HOME) {
+            target_x = WORLD_X16(HOMEBASE_WORLD_X + (24 << SUBPIXEL_BITS));
             is_moving_state = true;
         }
-        else if (hostages[i].state == H_STATE_WAVING) {
-            hostages[i].anim_timer++;
-            if (hostages[i].anim_timer > 120) {
+        else if (hostage_state[i] == H_STATE_WAVING) {
+            hostage_timer[i]++;
+            if (hostage_timer[i] > 120) {
                 hostages_rescued_count++;
-                hostages[i].state = H_STATE_INACTIVE;
-                xram0_struct_set(cfg, vga_mode4_sprite_t, y_pos_px, -32);
+                hostage_state[i] = H_STATE_INACTIVE;
+                pool_free(&hostage_pool, i);
+                sprite_hide(slot);
                 sfx_hostage_rescue(); 
                 continue;
             }
@@ -223,91 +346,86 @@ void update_hostages(void) {
         int8_t intended_dir = 0;
 
         if (is_moving_state) {
-            int32_t host_cx = hostages[i].world_x + (8 << SUBPIXEL_BITS);
-            int32_t diff = target_x - host_cx;
+            WorldX16 host_cx = hostage_x[i] + (8 << SUBPIXEL_BITS);
+            int16_t diff = WORLD_DX16(target_x, host_cx);
             
-            if (labs(diff) > (8 << SUBPIXEL_BITS)) {
+            if (abs(diff) > (8 << SUBPIXEL_BITS)) {
                 intended_dir = (diff > 0) ? 1 : -1;
             } else {
                 // *** ARRIVED AT TARGET ***
                 intended_dir = 0; 
 
-                if (hostages[i].state == H_STATE_RUNNING_CHOPPER) {
+                if (hostage_state[i] == H_STATE_RUNNING_CHOPPER) {
                     // Only board if we are actually AT the chopper (check distance again)
                     // (If we arrived at the "Wander Point", this check will fail, which is correct)
-                    int32_t dist_to_chopper = labs(chopper_center_x - host_cx);
+                    int16_t dist_to_chopper = abs(WORLD_DX16(chopper_center_x, host_cx));
                     
                     if (is_chopper_landed && dist_to_chopper < (12 << SUBPIXEL_BITS) && player_state == PLAYER_ALIVE) {
-                        hostages[i].state = H_STATE_ON_BOARD;
+                        hostage_state[i] = H_STATE_ON_BOARD;
                         hostages_on_board++;
-                        xram0_struct_set(cfg, vga_mode4_sprite_t, y_pos_px, -32);
+                        sprite_hide(slot);
                         sfx_hostage_rescue();
                         continue;
                     }
                 }
-                else if (hostages[i].state == H_STATE_RUNNING_HOME) {
-                    if (hostages[i].base_id == 99) {
-                        hostages[i].state = H_STATE_WAVING;
-                        hostages[i].anim_timer = 0;
+                else if (hostage_state[i] == H_STATE_RUNNING_HOME) {
+                    if (hostage_base[i] == 99) {
+                        hostage_state[i] = H_STATE_WAVING;
+                        hostage_timer[i] = 0;
                     } else {
                         hostages_rescued_count++;
-                        hostages[i].state = H_STATE_INACTIVE;
-                        xram0_struct_set(cfg, vga_mode4_sprite_t, y_pos_px, -32);
+                        hostage_state[i] = H_STATE_INACTIVE;
+                        pool_free(&hostage_pool, i);
+                        sprite_hide(slot);
                         sfx_hostage_rescue(); 
                         continue;
                     }
                 }
             }
 
-            // Spacing Logic
-            if (intended_dir != 0) {
-                for (int other = 0; other < NUM_HOSTAGES; other++) {
-                    if (i == other) continue;
-                    if (hostages[other].state == H_STATE_INACTIVE ||
-                        hostages[other].state == H_STATE_ON_BOARD || 
-                        hostages[other].state == H_STATE_SAFE || 
-                        hostages[other].state == H_STATE_DYING ||
-                        hostages[other].state == H_STATE_WAVING) continue;
-
-                    int32_t sep = hostages[other].world_x - hostages[i].world_x;
-                    if (intended_dir == 1 && sep > 0 && sep < (12<<4)) intended_dir = 0;
-                    if (intended_dir == -1 && sep < 0 && sep > -(12<<4)) intended_dir = 0;
-                }
+            // Spacing Logic (neighbours in the crowd list only)
+            if (intended_dir != 0 && crowd_blocked(i, intended_dir)) {
+                intended_dir = 0;
             }
 
-            if (intended_dir == 1)  hostages[i].world_x += HOSTAGE_RUN_SPEED;
-            if (intended_dir == -1) hostages[i].world_x -= HOSTAGE_RUN_SPEED;
+            if (intended_dir != 0) {
+                hostage_x[i] += (intended_dir == 1) ? HOSTAGE_RUN_SPEED : -HOSTAGE_RUN_SPEED;
+                crowd_settle(i);
+            }
         }
 
         // --- ANIMATION ---
-        if (hostages[i].state != H_STATE_WAVING) {
-            hostages[i].anim_timer++;
-            if (hostages[i].anim_timer > 6) {
-                hostages[i].anim_timer = 0;
-                if (intended_dir == 1) {
-                    hostages[i].anim_frame = (hostages[i].anim_frame < 2) ? hostages[i].anim_frame + 1 : 0;
-                } else if (intended_dir == -1) {
-                    hostages[i].anim_frame = (hostages[i].anim_frame < 3 || hostages[i].anim_frame > 4) ? 3 : hostages[i].anim_frame + 1;
-                } else {
-                    hostages[i].anim_frame = (hostages[i].anim_frame == 8) ? 9 : 8;
-                }
-            }
-        } else {
-            if ((hostages[i].anim_timer % 10) == 0) {
-                hostages[i].anim_frame = (hostages[i].anim_frame == 8) ? 9 : 8;
-            }
+        const AnimClip *clip;
+        if (hostage_state[i] == H_STATE_WAVING) clip = &ANIM_HOSTAGE_WAVE;
+        else if (intended_dir == 1)             clip = &ANIM_HOSTAGE_RUN_RIGHT;
+        else if (intended_dir == -1)            clip = &ANIM_HOSTAGE_RUN_LEFT;
+        else                                    clip = &ANIM_HOSTAGE_IDLE;
+
+        anim_play(&hostage_anim[i], clip);
+        if (anim_step(&hostage_anim[i]) == ANIM_CHANGED) {
+            sprite_set(slot, xram_sprite_ptr, anim_cell(&hostage_anim[i]));
         }
 
+        // --- HITBOX (bullets and the chopper's skids) ---
+        collision_add(COL_HOSTAGE, i, hostage_x[i], hostage_y[i]);
+
         // --- RENDER ---
-        int32_t screen_sub = hostages[i].world_x - camera_x;
-        int16_t screen_px = screen_sub >> SUBPIXEL_BITS;
+        int16_t screen_px = SCREEN_PX16(hostage_x[i]);
 
-        if (screen_px > -16 && screen_px < 336) {
-            xram0_struct_set(cfg, vga_mode4_sprite_t, x_pos_px, screen_px);
-            xram0_struct_set(cfg, vga_mode4_sprite_t, y_pos_px, hostages[i].y >> SUBPIXEL_BITS);
-            xram0_struct_set(cfg, vga_mode4_sprite_t, xram_sprite_ptr, get_hostage_ptr(hostages[i].anim_frame));
+        if (ON_SCREEN(screen_px, 16)) {
+            sprite_show(slot, screen_px, Y_PX(hostage_y[i]));
         } else {
-            xram0_struct_set(cfg, vga_mode4_sprite_t, y_pos_px, -32);
+            sprite_hide(slot);
         }
     }
-}
\ No newline at end of file
+}
+
+// Called by collision_run() for each hostage under the chopper's skids
+void hostage_on_crush(const Collider *target) {
+    uint8_t i = target->index;
+    if (target->type != COL_HOSTAGE || hostage_state[i] == H_STATE_DYING) return;
+
+    hostage_state[i] = H_STATE_DYING;
+    spawn_small_explosion(hostage_x[i] + (8 << SUBPIXEL_BITS), hostage_y[i] + (8 << SUBPIXEL_BITS_Y));
+    sfx_hostage_die();
+}
@@ -1,6 +1,10 @@
 #ifndef HOSTAGES_H
 #define HOSTAGES_H
 
+#include "world.h"
+#include "pool.h"
+#include "anim.h"
+
 // Hostages
 #define TOTAL_HOSTAGES  64  // This should be NUM_ENEMY_BASES * HOSTAGES_PER_BASE
 #define NUM_HOSTAGES    16
@@ -32,17 +36,19 @@ typedef enum {
     H_STATE_DYING           // Crushed/Shot
 } HostageState;
 
-typedef struct {
-    HostageState state;     // Replaces simple 'active' bool logic
-    int32_t world_x;
-    int16_t y;
-    int8_t direction;       // 1 = Right, -1 = Left
-    uint8_t anim_frame;     
-    uint8_t anim_timer;     
-    uint8_t base_id;        
-} Hostage;
+// Hostage pool, one array per field (index = slot). Each loop only pulls
+// in the fields it actually reads, and the 6502 indexes a byte array with
+// a plain abs,X instead of multiplying the slot by the struct size.
+extern uint8_t  hostage_state[];    // HostageState, in zero page
+extern WorldX16 hostage_x[];        // See world.h
+extern uint16_t hostage_y[];        // 8.8
+extern int8_t   hostage_dir[];      // 1 = Right, -1 = Left
+extern AnimCursor hostage_anim[];
+extern uint8_t  hostage_timer[];    // Waving countdown
+extern uint8_t  hostage_base[];
 
-extern Hostage hostages[];
+// Slots in use: any state but H_STATE_INACTIVE
+extern Pool     hostage_pool;
 
 extern uint8_t hostages_on_board;
 extern uint8_t hostages_rescued_count;
@@ -52,5 +58,6 @@ extern uint8_t dropoff_timer;
 
 extern void update_hostages(void);
 extern void kill_all_passengers(void);
+extern void reset_hostage_crowd(void);
 
 #endif // HOSTAGES_H
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "hud.h"
 #include "hostages.h"
 #include "player.h"
+#include "sprites.h"
 
 char message[MESSAGE_LENGTH];
 
@@ -58,22 +59,21 @@ void clear_sortie_message(void) {
 
 void update_lives_display(void) {
     for (int i = 0; i < LIVES_STARTING; i++) {
-        unsigned cfg = MINICHOPPER_CONFIG + (i * sizeof(vga_mode4_sprite_t));
+        uint8_t slot = SPR_MINICHOPPER + i;
         
         // Only draw sprites for lives we HAVE (excluding current one usually, or including?)
         // Let's show "Spare Lives" (Lives - 1).
         if (i < (lives - 1)) {
-            xram0_struct_set(cfg, vga_mode4_sprite_t, x_pos_px, (8 + (i * 10)));
-            xram0_struct_set(cfg, vga_mode4_sprite_t, y_pos_px, 220); // Bottom of screen
+            sprite_show(slot, (8 + (i * 10)), 220); // Bottom of screen
         } else {
-            xram0_struct_set(cfg, vga_mode4_sprite_t, y_pos_px, -32); // Hide
+            sprite_hide(slot); // Hide
         }
     }
 }
 
 // Clear all 15 rows of text
 void clear_text_screen(void) {
-    RIA.addr0 = text_message_addr;
+    RIA.addr0 = TEXT_MESSAGE_ADDR;
     RIA.step0 = 1;
     
     // Fill 40x15 chars with 0 (Transparent)
@@ -86,7 +86,7 @@ void clear_text_screen(void) {
 void draw_text(uint8_t x, uint8_t y, const char* str, uint8_t color) {
     // Calculate offset: (y * width + x) * 3 bytes
     unsigned offset = ((y * MESSAGE_WIDTH) + x) * 3;
-    unsigned addr = text_message_addr + offset;
+    unsigned addr = TEXT_MESSAGE_ADDR + offset;
 
     RIA.addr0 = addr;
     RIA.step0 = 1;
@@ -108,7 +108,7 @@ void draw_text(uint8_t x, uint8_t y, const char* str, uint8_t color) {
 void draw_hud_stat(uint8_t offset, uint8_t icon, uint8_t color, int value) {
     
     // 1. Calculate XRAM Address (3 bytes per char)
-    unsigned addr = text_message_addr + (offset * 3);
+    unsigned addr = TEXT_MESSAGE_ADDR + (offset * 3);
     
     RIA.addr0 = addr;
     RIA.step0 = 1;
@@ -19,18 +19,10 @@ gamepad_t gamepad[GAMEPAD_COUNT];
 uint8_t keystates[KEYBOARD_BYTES] = {0};
 bool handled_key = false;
 
-// Helper for checking if any input is pressed (mainly for demo mode)
-bool is_any_input_pressed(void) {
-    // Check all relevant bits
-    if (is_action_pressed(0, ACTION_THRUST)) return true;
-    if (is_action_pressed(0, ACTION_REVERSE_THRUST)) return true;
-    if (is_action_pressed(0, ACTION_ROTATE_LEFT)) return true;
-    if (is_action_pressed(0, ACTION_ROTATE_RIGHT)) return true;
-    if (is_action_pressed(0, ACTION_FIRE)) return true;
-    if (is_action_pressed(0, ACTION_SUPER_FIRE)) return true;
-    if (is_action_pressed(0, ACTION_PAUSE)) return true;
-    return false;
-}
+// Action bitmasks, rebuilt every handle_input()
+ActionMask action_held[GAMEPAD_COUNT];
+ActionMask action_pressed[GAMEPAD_COUNT];
+ActionMask action_released[GAMEPAD_COUNT];
 
 /**
  * Reset to default button mappings for a specific player
@@ -183,40 +175,30 @@ void handle_input(void)
         gamepad[i].l2 = RIA.rw0;
         gamepad[i].r2 = RIA.rw0;
     }
-    
-}
 
-/**
- * Check if a game action is active for a specific player
- */
-bool is_action_pressed(uint8_t player_id, GameAction action)
-{
-    if (player_id >= GAMEPAD_COUNT || action >= ACTION_COUNT) {
-        return false;
-    }
-    
-    ButtonMapping* mapping = &button_mappings[player_id][action];
-    
-    // Check keyboard (player 0 only for now)
-    if (player_id == 0) {
-        if (key(mapping->keyboard_key)) {
-            return true;
+    // Resolve the mappings once for the whole frame
+    for (uint8_t player = 0; player < GAMEPAD_COUNT; player++) {
+        ActionMask held = 0;
+        ButtonMapping *mapping = button_mappings[player];
+
+        // dpad, sticks, btn0, btn1 are the first four bytes, in
+        // GP_FIELD_* order, so the mapping's field indexes them directly
+        const uint8_t *fields = &gamepad[player].dpad;
+        bool connected = (gamepad[player].dpad & GP_CONNECTED) != 0;
+
+        for (uint8_t action = 0; action < ACTION_COUNT; action++, mapping++) {
+            // Keyboard (player 0 only for now)
+            if (player == 0 && key(mapping->keyboard_key)) {
+                held |= ACTION_BIT(action);
+            }
+            else if (connected && mapping->gamepad_button <= GP_FIELD_BTN1 &&
+                     (fields[mapping->gamepad_button] & mapping->gamepad_mask)) {
+                held |= ACTION_BIT(action);
+            }
         }
+
+        action_pressed[player] = held & ~action_held[player];
+        action_released[player] = action_held[player] & ~held;
+        action_held[player] = held;
     }
-    
-    // Only check gamepad if one is connected
-    if (!(gamepad[player_id].dpad & GP_CONNECTED)) {
-        return false;
-    }
-    
-    // Check gamepad
-    uint8_t gamepad_value = 0;
-    switch (mapping->gamepad_button) {
-        case 0: gamepad_value = gamepad[player_id].dpad; break;
-        case 1: gamepad_value = gamepad[player_id].sticks; break;
-        case 2: gamepad_value = gamepad[player_id].btn0; break;
-        case 3: gamepad_value = gamepad[player_id].btn1; break;
-    }
-    
-    return (gamepad_value & mapping->gamepad_mask) != 0;
-}
\ No newline at end of file
+}
@@ -28,6 +28,8 @@ typedef enum {
     ACTION_COUNT  // Total number of actions
 } GameAction;
 
+_Static_assert(ACTION_COUNT <= 8, "ActionMask is a uint8_t");
+
 // Gamepad structure (10 bytes per gamepad)
 typedef struct {
     uint8_t dpad;      // Direction pad + status bits
@@ -55,9 +57,34 @@ typedef struct {
 #define GP_FIELD_BTN0    2  // Face Buttons (A,B,X,Y)
 #define GP_FIELD_BTN1    3  // Triggers/Select/Start
 
+// ============================================================================
+// PER-FRAME ACTION STATE
+// ============================================================================
+// handle_input() resolves every ButtonMapping once per frame into a bitmask
+// per player (bit n = GameAction n). Everything else just tests bits:
+//   held     - down this frame
+//   pressed  - down this frame, up last frame (edge)
+//   released - up this frame, down last frame
+// so modules don't need their own "last state" flags for debouncing.
+
+typedef uint8_t ActionMask;
+#define ACTION_BIT(action) ((ActionMask)(1 << (action)))
+
+extern ActionMask action_held[GAMEPAD_COUNT];
+extern ActionMask action_pressed[GAMEPAD_COUNT];
+extern ActionMask action_released[GAMEPAD_COUNT];
+
+#define is_action_pressed(player_id, action) \
+    ((action_held[player_id] & ACTION_BIT(action)) != 0)
+#define is_action_just_pressed(player_id, action) \
+    ((action_pressed[player_id] & ACTION_BIT(action)) != 0)
+#define is_action_just_released(player_id, action) \
+    ((action_released[player_id] & ACTION_BIT(action)) != 0)
+
+// Any mapped action held by player 0 (demo mode / idle timeout)
+#define is_any_input_pressed() (action_held[0] != 0)
+
 extern void init_input_system(void);
 extern void handle_input(void);
-extern bool is_action_pressed(uint8_t player_id, GameAction action);
-extern bool is_any_input_pressed(void);
 
 #endif // INPUT_H
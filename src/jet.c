@@ -1,7 +1,7 @@
 #include <rp6502.h>
 #include <stdint.h>
 #include <stdbool.h>
-#include <stdlib.h> // for rand()
+#include <stdlib.h>
 #include "constants.h"
 #include "player.h"
 #include "input.h" // camera_x
@@ -10,9 +10,13 @@
 #include "smallexplosion.h"
 #include "explosion.h"
 #include "sound.h"
+#include "sprites.h"
+#include "collision.h"
+#include "rng.h"
+#include "luts.h"
 
 
-#define JET_GROUND_Y_SUB  (GROUND_Y_SUB + (14 << SUBPIXEL_BITS)) // Ground level for enemy bullets
+#define JET_GROUND_Y_SUB  (GROUND_Y_SUB + (14 << SUBPIXEL_BITS_Y)) // Ground level for enemy bullets
 
 FighterJet jet;
 
@@ -20,12 +24,6 @@ FighterJet jet;
 uint16_t timer_loiter_ground = 0;
 uint16_t timer_loiter_air = 0;
 
-// Sprite Helper
-// 8x8 sprite = 128 bytes
-uint16_t get_jet_ptr(int index) {
-    return JET_DATA + (index * 128);
-}
-
 void reset_jet(void) {
     // Reset Logic State
     jet.state = JET_INACTIVE;
@@ -36,10 +34,10 @@ void reset_jet(void) {
     timer_loiter_air = 0;
 
     // Hide Sprites (Hardware)
-    xram0_struct_set(JET_LEFT_CONFIG, vga_mode4_sprite_t, y_pos_px, -32);
-    xram0_struct_set(JET_RIGHT_CONFIG, vga_mode4_sprite_t, y_pos_px, -32);
-    xram0_struct_set(JET_BULLET_CONFIG, vga_mode4_sprite_t, y_pos_px, -32);
-    xram0_struct_set(JET_BOMB_CONFIG, vga_mode4_sprite_t, y_pos_px, -32);
+    sprite_hide(SPR_JET_LEFT);
+    sprite_hide(SPR_JET_RIGHT);
+    sprite_hide(SPR_JET_BULLET);
+    sprite_hide(SPR_JET_BOMB);
 }
 
 void update_jet(void) {
@@ -74,7 +72,7 @@ void update_jet(void) {
         if (chopper_y >= GROUND_Y_SUB) {
             timer_loiter_ground++;
             if (timer_loiter_ground > TIMER_GROUND_MAX) {
-                if ((rand() % 100) < 2) { // Random chance per frame once threshold met
+                if (rng_chance(2)) { // Random chance per frame once threshold met
                     try_spawn = true;
                     mode = WEAPON_BOMB;
                 }
@@ -87,7 +85,7 @@ void update_jet(void) {
         if (chopper_y < AIR_ZONE_Y) {
             timer_loiter_air++;
             if (timer_loiter_air > TIMER_AIR_MAX) {
-                if ((rand() % 100) < 2) {
+                if (rng_chance(2)) {
                     try_spawn = true;
                     mode = WEAPON_BULLET;
                 }
@@ -104,7 +102,7 @@ void update_jet(void) {
             jet.weapon_active = false;
             
             // Random Direction
-            jet.direction = (rand() % 2 == 0) ? 1 : -1;
+            jet.direction = rng_coin() ? 1 : -1;
 
             // X Position: Offscreen
             if (jet.direction == 1) { // Moving Right (Spawn Left)
@@ -116,10 +114,10 @@ void update_jet(void) {
             // Y Position
             if (mode == WEAPON_BOMB) {
                 // Bomber flies fairly low to hit ground target accurately
-                jet.y = GROUND_Y_SUB - (80 << SUBPIXEL_BITS); 
+                jet.y = GROUND_Y_SUB - (80 << SUBPIXEL_BITS_Y); 
             } else {
                 // Interceptor flies at player altitude
-                jet.y = chopper_y + (12 << SUBPIXEL_BITS);
+                jet.y = chopper_y + (12 << SUBPIXEL_BITS_Y);
             }
             
             // Reset timers
@@ -128,10 +126,10 @@ void update_jet(void) {
         }
         
         // Hide Sprites if inactive
-        xram0_struct_set(JET_LEFT_CONFIG, vga_mode4_sprite_t, y_pos_px, -32);
-        xram0_struct_set(JET_RIGHT_CONFIG, vga_mode4_sprite_t, y_pos_px, -32);
-        xram0_struct_set(JET_BULLET_CONFIG, vga_mode4_sprite_t, y_pos_px, -32);
-        xram0_struct_set(JET_BOMB_CONFIG, vga_mode4_sprite_t, y_pos_px, -32);
+        sprite_hide(SPR_JET_LEFT);
+        sprite_hide(SPR_JET_RIGHT);
+        sprite_hide(SPR_JET_BULLET);
+        sprite_hide(SPR_JET_BOMB);
         return;
     }
 
@@ -179,7 +177,7 @@ void update_jet(void) {
             if (should_drop) {
                 jet.weapon_active = true;
                 jet.w_x = jet.world_x + (8 << SUBPIXEL_BITS); // Center of jet
-                jet.w_y = jet.y + (8 << SUBPIXEL_BITS);
+                jet.w_y = jet.y + (8 << SUBPIXEL_BITS_Y);
                 
                 // Inherit momentum (2.0 pixels/frame)
                 jet.w_vx = (jet.direction == 1) ? (2 << 4) : -(2 << 4); 
@@ -196,7 +194,7 @@ void update_jet(void) {
             if (labs(dist) < (100 << SUBPIXEL_BITS)) {
                 jet.weapon_active = true;
                 jet.w_x = jet.world_x + ((jet.direction == 1 ? 16 : 0) << SUBPIXEL_BITS);
-                jet.w_y = jet.y + (4 << SUBPIXEL_BITS);
+                jet.w_y = jet.y + (4 << SUBPIXEL_BITS_Y);
                 
                 // Fire towards chopper
                 jet.w_vx = (jet.direction == 1) ? JET_BULLET_SPEED : -JET_BULLET_SPEED;
@@ -218,7 +216,7 @@ void update_jet(void) {
     // DESPAWN CHECK
     int32_t screen_sub = jet.world_x - camera_x;
     int16_t screen_px = screen_sub >> SUBPIXEL_BITS;
-    int16_t screen_y = jet.y >> SUBPIXEL_BITS;
+    int16_t screen_y = Y_PX(jet.y);
 
     if (screen_px < -32 || screen_px > 350 || screen_y < -32) {
         jet.state = JET_INACTIVE;
@@ -237,7 +235,7 @@ void update_jet(void) {
             // Ground Check
             if (jet.w_y >= JET_GROUND_Y_SUB) {
                 jet.weapon_active = false;
-                spawn_small_explosion(jet.w_x, JET_GROUND_Y_SUB);
+                spawn_small_explosion(WORLD_X16(jet.w_x), JET_GROUND_Y_SUB);
                 // Check if it hit the chopper on ground?
                 // For fairness, maybe bombs only kill chopper if direct hit, 
                 // but let's assume direct hit logic below covers it.
@@ -251,20 +249,13 @@ void update_jet(void) {
     }
 
     // =========================================================
-    // 4. COLLISION: WEAPON VS PLAYER
+    // 4. COLLISION (player bullets vs jet, weapon vs player)
     // =========================================================
-    if (jet.weapon_active && player_state == PLAYER_ALIVE) {
-        int32_t chop_cx = chopper_world_x + (16 << SUBPIXEL_BITS);
-        int32_t chop_cy = chopper_y + (8 << SUBPIXEL_BITS);
-        
-        // Hitbox: +/- 10px
-        if (labs(jet.w_x - chop_cx) < (10 << SUBPIXEL_BITS)) {
-            if (labs(jet.w_y - chop_cy) < (10 << SUBPIXEL_BITS)) {
-                kill_player();
-                trigger_explosion(jet.w_x, jet.w_y);
-                jet.weapon_active = false;
-            }
-        }
+    if (jet.state != JET_INACTIVE) {
+        collision_add(COL_JET, 0, WORLD_X16(jet.world_x), jet.y);
+    }
+    if (jet.weapon_active) {
+        collision_add(COL_JET_WEAPON, 0, WORLD_X16(jet.w_x), jet.w_y);
     }
 
     // =========================================================
@@ -277,29 +268,37 @@ void update_jet(void) {
         int idx1 = (jet.direction == 1) ? 2 : 0;
         int idx2 = idx1 + 1;
 
-        xram0_struct_set(JET_LEFT_CONFIG, vga_mode4_sprite_t, x_pos_px, screen_px);
-        xram0_struct_set(JET_LEFT_CONFIG, vga_mode4_sprite_t, y_pos_px, screen_y);
-        xram0_struct_set(JET_LEFT_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, get_jet_ptr(idx1));
+        sprite_show(SPR_JET_LEFT, screen_px, screen_y);
+        sprite_set(SPR_JET_LEFT, xram_sprite_ptr, JET_SPRITE_PTR[idx1]);
 
-        xram0_struct_set(JET_RIGHT_CONFIG, vga_mode4_sprite_t, x_pos_px, (screen_px + 8));
-        xram0_struct_set(JET_RIGHT_CONFIG, vga_mode4_sprite_t, y_pos_px, screen_y);
-        xram0_struct_set(JET_RIGHT_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, get_jet_ptr(idx2));
+        sprite_show(SPR_JET_RIGHT, (screen_px + 8), screen_y);
+        sprite_set(SPR_JET_RIGHT, xram_sprite_ptr, JET_SPRITE_PTR[idx2]);
     }
 
     // Draw Weapon
     if (jet.weapon_active) {
-        unsigned w_cfg = (jet.weapon_type == WEAPON_BOMB) ? JET_BOMB_CONFIG : JET_BULLET_CONFIG;
-        unsigned other = (jet.weapon_type == WEAPON_BOMB) ? JET_BULLET_CONFIG : JET_BOMB_CONFIG;
+        uint8_t w_slot = (jet.weapon_type == WEAPON_BOMB) ? SPR_JET_BOMB : SPR_JET_BULLET;
+        uint8_t other = (jet.weapon_type == WEAPON_BOMB) ? SPR_JET_BULLET : SPR_JET_BOMB;
         
         int16_t w_px = (jet.w_x - camera_x) >> SUBPIXEL_BITS;
-        xram0_struct_set(w_cfg, vga_mode4_sprite_t, x_pos_px, w_px);
-        xram0_struct_set(w_cfg, vga_mode4_sprite_t, y_pos_px, jet.w_y >> SUBPIXEL_BITS);
+        sprite_show(w_slot, w_px, Y_PX(jet.w_y));
         
         // Hide the unused weapon config
-        xram0_struct_set(other, vga_mode4_sprite_t, y_pos_px, -32);
+        sprite_hide(other);
     } else {
-        xram0_struct_set(JET_BOMB_CONFIG, vga_mode4_sprite_t, y_pos_px, -32);
-        xram0_struct_set(JET_BULLET_CONFIG, vga_mode4_sprite_t, y_pos_px, -32);
+        sprite_hide(SPR_JET_BOMB);
+        sprite_hide(SPR_JET_BULLET);
     }
 }
 
+// Called by collision_run() when the jet's bullet or bomb touches the chopper
+void jet_weapon_on_contact(const Collider *target) {
+    if (target->type != COL_CHOPPER_JET_TARGET) return;
+    if (!jet.weapon_active || player_state != PLAYER_ALIVE) return;
+
+    kill_player();
+    trigger_explosion(jet.w_x, jet.w_y);
+    jet.weapon_active = false;
+    sprite_hide(SPR_JET_BOMB);
+    sprite_hide(SPR_JET_BULLET);
+}
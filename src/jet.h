@@ -3,15 +3,15 @@
 
 // --- CONFIGURATION ---
 #define JET_SPEED_X         (4 << SUBPIXEL_BITS) // Fast!
-#define JET_CLIMB_SPEED     (2 << SUBPIXEL_BITS)
+#define JET_CLIMB_SPEED     (2 << SUBPIXEL_BITS_Y)
 #define JET_BULLET_SPEED    (6 << SUBPIXEL_BITS)
-#define JET_BOMB_GRAVITY    2 
+#define JET_BOMB_GRAVITY    (ONE_PIXEL_Y / 8) 
 
 // Triggers
 #define JET_MIN_PROGRESS    24
 #define TIMER_GROUND_MAX    120 // 2 Seconds
 #define TIMER_AIR_MAX       240 // 4 Seconds
-#define AIR_ZONE_Y          (75 << SUBPIXEL_BITS) // Top 75 pixels
+#define AIR_ZONE_Y          (75 << SUBPIXEL_BITS_Y) // Top 75 pixels
 
 extern void update_jet(void);
 extern void reset_jet(void);
@@ -3,46 +3,42 @@
 #include "constants.h"
 #include "player.h"
 #include "landing.h"
+#include "sprites.h"
+#include "world.h"
 
+// world.scroll_px the pad was last placed for
+static int16_t landing_drawn_scroll = WORLD_NOT_DRAWN;
 
 void update_landing(void) {
+    // The pad never moves, so only a camera pixel step can move its sprites
+    if (world.scroll_px == landing_drawn_scroll) return;
+    landing_drawn_scroll = world.scroll_px;
+
     // It sits ON the ground.
     // Height is 1 sprite (16 pixels).
     const int16_t BASE_Y = GROUND_Y + 6; 
 
-    for (int i = 0; i < NUM_LANDING_PAD_SPRITE; i++) {
-        unsigned cfg_addr = LANDINGPAD_CONFIG + (i * sizeof(vga_mode4_sprite_t));
-
-        // ---------------------------------------------------
-        // 1. CALCULATE LAYOUT (Horizontal Strip)
-        // ---------------------------------------------------
-        // i = 0, 1, 2, ... 8
-        int16_t offset_x_px = i * 16;
+    // ---------------------------------------------------
+    // 1. CALCULATE SCREEN POSITION (Horizontal Strip)
+    // ---------------------------------------------------
+    // The pad is pixel aligned, so Screen = World px + scroll
+    int16_t screen_x_px = (int16_t)(LANDING_PAD_WORLD_X >> SUBPIXEL_BITS) + world.scroll_px;
 
-        // ---------------------------------------------------
-        // 2. CALCULATE SCREEN POSITION
-        // ---------------------------------------------------
-        // World Pos = Base + Offset
-        int32_t sprite_world_x = LANDING_PAD_WORLD_X + (offset_x_px << SUBPIXEL_BITS);
-        
-        // Screen Pos = World - Camera
-        // Note: Make sure to subtract camera first before shifting down to pixels
-        int32_t screen_x_sub = sprite_world_x - camera_x;
-        int16_t screen_x_px = screen_x_sub >> SUBPIXEL_BITS;
+    for (int i = 0; i < NUM_LANDING_PAD_SPRITE; i++, screen_x_px += 16) {
+        uint8_t slot = SPR_LANDINGPAD + i;
 
         // ---------------------------------------------------
-        // 3. CULLING & UPDATE
+        // 2. CULLING & UPDATE
         // ---------------------------------------------------
         // Check if visible (-16 to 336 pixels)
         // 320 screen width + 16 buffer
-        if (screen_x_px > -16 && screen_x_px < 336) {
+        if (ON_SCREEN(screen_x_px, 16)) {
             // Visible: Draw at correct X and fixed Ground Y
-            xram0_struct_set(cfg_addr, vga_mode4_sprite_t, x_pos_px, screen_x_px);
-            xram0_struct_set(cfg_addr, vga_mode4_sprite_t, y_pos_px, BASE_Y);
+            sprite_show(slot, screen_x_px, BASE_Y);
         } 
         else {
             // Hidden: Move offscreen vertically
-            xram0_struct_set(cfg_addr, vga_mode4_sprite_t, y_pos_px, -32);
+            sprite_hide(slot);
         }
     }
 }
\ No newline at end of file
@@ -24,39 +24,14 @@
 #include "music.h"
 #include "highscore.h"
 #include "boom.h"
-
-
-unsigned CHOPPER_CONFIG;            // Chopper Sprite Configuration
-unsigned CHOPPER_LEFT_CONFIG;       // Chopper Left Sprite Configuration
-unsigned CHOPPER_RIGHT_CONFIG;      // Chopper Right Sprite Configuration
-unsigned GROUND_CONFIG;             // Ground Background Configuration
-unsigned GROUND_MAP_START;          // Ground Background Configuration
-unsigned GROUND_MAP_END;
-unsigned CLOUD_A_CONFIG;            // Cloud A Sprite Configuration
-unsigned CLOUD_B_CONFIG;            // Cloud B Sprite Configuration
-unsigned CLOUD_C_CONFIG;            // Cloud C Sprite Configuration
-unsigned LANDINGPAD_CONFIG;         // Landing Pad Sprite Configuration
-unsigned HOMEBASE_CONFIG;           // Home Base Sprite Configuration
-unsigned ENEMYBASE_CONFIG;          // Enemy Base Sprite Configuration
-unsigned FLAGS_CONFIG;              // Flags Sprite Configuration
-unsigned BULLET_CONFIG;             // Bullet Sprite Configuration
-unsigned HOSTAGE_CONFIG;            // Hostage Sprite Configuration
-unsigned TEXT_CONFIG;               // Text Plane Configuration
-unsigned text_message_addr;         // Text message address
-unsigned EXPLOSION_LEFT_CONFIG;     // Explosion Sprite Configuration
-unsigned EXPLOSION_RIGHT_CONFIG;    // Explosion Sprite Configuration
-unsigned SMALL_EXPLOSION_CONFIG;    // Small Explosion Sprite Configuration
-unsigned TANK_CONFIG;               // Tank Sprite Configuration
-unsigned EBULLET_CONFIG;            // Enemy Bullet Sprite Configuration
-unsigned BOOM_CONFIG;               // Boom Sprite Configuration
-unsigned BALLOON_BOTTOM_CONFIG;     // Balloon Bottom Sprite Configuration
-unsigned BALLOON_TOP_CONFIG;        // Balloon Top Sprite Configuration
-unsigned JET_LEFT_CONFIG;           // Jet Left Sprite Configuration
-unsigned JET_RIGHT_CONFIG;          // Jet Right Sprite Configuration
-unsigned BOMB_CONFIG;               // Bomb Sprite Configuration
-unsigned JET_BULLET_CONFIG;         // Jet Bullet Sprite Configuration
-unsigned JET_BOMB_CONFIG;           // Jet Bomb Sprite Configuration
-unsigned MINICHOPPER_CONFIG;        // Mini Chopper Sprite Configuration
+#include "sprites.h"
+#include "profile.h"
+#include "framestats.h"
+#include "collision.h"
+#include "world.h"
+#include "rng.h"
+#include "luts.h"
+#include "terrain.h"
 
 
 static void init_graphics(void)
@@ -91,178 +66,62 @@ static void init_graphics(void)
         RIA.rw0 = tile_palette[i] >> 8;
     }
 
-    CHOPPER_CONFIG = SPRITE_DATA_END;
-    CHOPPER_LEFT_CONFIG  = CHOPPER_CONFIG; // Chopper Left Sprite Configuration
-    CHOPPER_RIGHT_CONFIG = CHOPPER_CONFIG + sizeof(vga_mode4_sprite_t); // Chopper Right Sprite Configuration
-
-    // Initialize chopper sprite configuration
-    int16_t hardware_xl = chopper_xl >> SUBPIXEL_BITS;
-    int16_t hardware_xr = chopper_xr >> SUBPIXEL_BITS;
-    int16_t hardware_y = chopper_y >> SUBPIXEL_BITS;
-    xram0_struct_set(CHOPPER_LEFT_CONFIG, vga_mode4_sprite_t, x_pos_px, hardware_xl);
-    xram0_struct_set(CHOPPER_LEFT_CONFIG, vga_mode4_sprite_t, y_pos_px, hardware_y);
-    xram0_struct_set(CHOPPER_LEFT_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, get_chopper_sprite_ptr(0, 0));
-    xram0_struct_set(CHOPPER_LEFT_CONFIG, vga_mode4_sprite_t, log_size, 4);  // 16x16 sprite (2^4)
-    xram0_struct_set(CHOPPER_LEFT_CONFIG, vga_mode4_sprite_t, has_opacity_metadata, false);
-
-    xram0_struct_set(CHOPPER_RIGHT_CONFIG, vga_mode4_sprite_t, x_pos_px, hardware_xr);
-    xram0_struct_set(CHOPPER_RIGHT_CONFIG, vga_mode4_sprite_t, y_pos_px, hardware_y);
-    xram0_struct_set(CHOPPER_RIGHT_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, get_chopper_sprite_ptr(0, 1));
-    xram0_struct_set(CHOPPER_RIGHT_CONFIG, vga_mode4_sprite_t, log_size, 4);  // 16x16 sprite (2^4)
-    xram0_struct_set(CHOPPER_RIGHT_CONFIG, vga_mode4_sprite_t, has_opacity_metadata, false);
-
-
-    // Add in HOSTAGES
-    HOSTAGE_CONFIG = CHOPPER_RIGHT_CONFIG + sizeof(vga_mode4_sprite_t);
+    // -----------------------------------------------------
+    // SPRITE SHADOW TABLE
+    // -----------------------------------------------------
+    // All sprite records live in RAM (see sprites.c). Everything starts
+    // hidden and only claims an XRAM record once a module shows it.
+
+    init_sprite(SPR_CHOPPER_LEFT, CHOPPER_SPRITE_PTR[0][0], 4);   // 16x16 sprite (2^4)
+    init_sprite(SPR_CHOPPER_RIGHT, CHOPPER_SPRITE_PTR[0][1], 4);  // 16x16 sprite (2^4)
+    sprite_show(SPR_CHOPPER_LEFT, chopper_xl >> SUBPIXEL_BITS, Y_PX(chopper_y));
+    sprite_show(SPR_CHOPPER_RIGHT, chopper_xr >> SUBPIXEL_BITS, Y_PX(chopper_y));
+
+    // Add in HOSTAGES (16x16, 512 bytes each)
     for (int i = 0; i < NUM_HOSTAGES; i++) {
-        unsigned hostage_cfg = HOSTAGE_CONFIG + (i * sizeof(vga_mode4_sprite_t));
-        xram0_struct_set(hostage_cfg, vga_mode4_sprite_t, x_pos_px, -16); // Off-screen initially
-        xram0_struct_set(hostage_cfg, vga_mode4_sprite_t, y_pos_px, -16);
-        xram0_struct_set(hostage_cfg, vga_mode4_sprite_t, xram_sprite_ptr, HOSTAGES_DATA); // Each hostage is 16x16 (512 bytes)
-        xram0_struct_set(hostage_cfg, vga_mode4_sprite_t, log_size, 4);  // 16x16 sprite (2^4)
-        xram0_struct_set(hostage_cfg, vga_mode4_sprite_t, has_opacity_metadata, false);
+        init_sprite(SPR_HOSTAGE + i, HOSTAGES_DATA, 4);
     }
 
     // Add in BULLET
-    BULLET_CONFIG = HOSTAGE_CONFIG + (NUM_HOSTAGES * sizeof(vga_mode4_sprite_t));
-    xram0_struct_set(BULLET_CONFIG, vga_mode4_sprite_t, x_pos_px, -8); // Off-screen initially
-    xram0_struct_set(BULLET_CONFIG, vga_mode4_sprite_t, y_pos_px, -8);
-    xram0_struct_set(BULLET_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, BULLET_DATA); // Bullet sprite data
-    xram0_struct_set(BULLET_CONFIG, vga_mode4_sprite_t, log_size, 1);  // 2x2 sprite (2^1)
-    xram0_struct_set(BULLET_CONFIG, vga_mode4_sprite_t, has_opacity_metadata, false);
-
-    // Add in EXPLOSION
-    EXPLOSION_LEFT_CONFIG = BULLET_CONFIG + sizeof(vga_mode4_sprite_t);
-    xram0_struct_set(EXPLOSION_LEFT_CONFIG, vga_mode4_sprite_t, x_pos_px, -16); // Off-screen initially
-    xram0_struct_set(EXPLOSION_LEFT_CONFIG, vga_mode4_sprite_t, y_pos_px, -16);
-    xram0_struct_set(EXPLOSION_LEFT_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, EXPLOSION_DATA); // Explosion sprite data
-    xram0_struct_set(EXPLOSION_LEFT_CONFIG, vga_mode4_sprite_t, log_size, 4);  // 16x16 sprite (2^4)
-    xram0_struct_set(EXPLOSION_LEFT_CONFIG, vga_mode4_sprite_t, has_opacity_metadata, false);
-
-    EXPLOSION_RIGHT_CONFIG = EXPLOSION_LEFT_CONFIG + sizeof(vga_mode4_sprite_t);
-    xram0_struct_set(EXPLOSION_RIGHT_CONFIG, vga_mode4_sprite_t, x_pos_px, -16); // Off-screen initially
-    xram0_struct_set(EXPLOSION_RIGHT_CONFIG, vga_mode4_sprite_t, y_pos_px, -16);
-    xram0_struct_set(EXPLOSION_RIGHT_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, (EXPLOSION_DATA + 512)); // Explosion sprite data (right half)
-    xram0_struct_set(EXPLOSION_RIGHT_CONFIG, vga_mode4_sprite_t, log_size, 4);  // 16x16 sprite (2^4)
-    xram0_struct_set(EXPLOSION_RIGHT_CONFIG, vga_mode4_sprite_t, has_opacity_metadata, false);
-
-    SMALL_EXPLOSION_CONFIG = EXPLOSION_RIGHT_CONFIG + sizeof(vga_mode4_sprite_t);
+    init_sprite(SPR_BULLET, BULLET_DATA, 1);  // 2x2 sprite (2^1)
+
+    // Add in EXPLOSION (left and right halves)
+    init_sprite(SPR_EXPLOSION_LEFT, EXPLOSION_DATA, 4);
+    init_sprite(SPR_EXPLOSION_RIGHT, (EXPLOSION_DATA + 512), 4);
+
     for (uint8_t i = 0; i < MAX_EXPLOSIONS; i++) {
-        unsigned ptr = SMALL_EXPLOSION_CONFIG + i * sizeof(vga_mode4_sprite_t);
-        xram0_struct_set(ptr, vga_mode4_sprite_t, x_pos_px, -8); // Off-screen initially
-        xram0_struct_set(ptr, vga_mode4_sprite_t, y_pos_px, -8);
-        xram0_struct_set(ptr, vga_mode4_sprite_t, xram_sprite_ptr, SMALL_EXPLOSION_DATA);
-        xram0_struct_set(ptr, vga_mode4_sprite_t, log_size, 3);  // 8x8 sprite (2^3)
-        xram0_struct_set(ptr, vga_mode4_sprite_t, has_opacity_metadata, false);
+        init_sprite(SPR_SMALL_EXPLOSION + i, SMALL_EXPLOSION_DATA, 3);  // 8x8 sprite (2^3)
     }
 
-    TANK_CONFIG = SMALL_EXPLOSION_CONFIG + (MAX_EXPLOSIONS * sizeof(vga_mode4_sprite_t));
-   
-     // Configure all Tank Sprites
-    int total_tank_sprites = NUM_TANKS * SPRITES_PER_TANK; // 18
-    
-    for (int i = 0; i < total_tank_sprites; i++) {
-        unsigned cfg = TANK_CONFIG + (i * sizeof(vga_mode4_sprite_t));
-        
-        xram0_struct_set(cfg, vga_mode4_sprite_t, x_pos_px, -TANK_WIDTH_PX); // Off-screen initially
-        xram0_struct_set(cfg, vga_mode4_sprite_t, y_pos_px, -TANK_HEIGHT_PX);
-        // Each tank sprite is 8x8 (128 bytes)
-        xram0_struct_set(cfg, vga_mode4_sprite_t, xram_sprite_ptr, (TANK_DATA + (i * 128)));
-        xram0_struct_set(cfg, vga_mode4_sprite_t, log_size, 3);  // 8x8 sprite (2^3)
-        xram0_struct_set(cfg, vga_mode4_sprite_t, has_opacity_metadata, false);
-    }
+    // Configure all Tank Sprites (8x8, SPRITES_PER_TANK per tank)
+    init_tank_sprites();
 
     // Initialize Logical State
     for (int t = 0; t < NUM_TANKS; t++) {
-        tanks[t].active = false;
-        tanks[t].world_x = TANK_SPAWNS[t];
-        tanks[t].y = GROUND_Y_SUB + (32 << SUBPIXEL_BITS); // Sit on ground
-        tanks[t].direction = -1; // Move Left initially
-        tanks[t].health = 3;
+        tank_x[t] = WORLD_X16(TANK_SPAWNS[t]);
+        tank_y[t] = GROUND_Y_SUB + (32 << SUBPIXEL_BITS_Y); // Sit on ground
+        tank_dir[t] = -1; // Move Left initially
+        tank_health[t] = 3;
     }
 
-    EBULLET_CONFIG = TANK_CONFIG + (total_tank_sprites * sizeof(vga_mode4_sprite_t));
-
+    // Enemy Bullets -- same sprite as player bullet
     for (int i = 0; i < NEBULLET; i++) {
-        unsigned ebullet_cfg = EBULLET_CONFIG + (i * sizeof(vga_mode4_sprite_t));
-        xram0_struct_set(ebullet_cfg, vga_mode4_sprite_t, x_pos_px, -8); // Off-screen initially
-        xram0_struct_set(ebullet_cfg, vga_mode4_sprite_t, y_pos_px, -8); 
-        xram0_struct_set(ebullet_cfg, vga_mode4_sprite_t, xram_sprite_ptr, BULLET_DATA); // Enemy Bullet sprite data -- same as player bullet
-        xram0_struct_set(ebullet_cfg, vga_mode4_sprite_t, log_size, 1);  // 2x2 sprite (2^1) 
-        xram0_struct_set(ebullet_cfg, vga_mode4_sprite_t, has_opacity_metadata, false);
+        init_sprite(SPR_EBULLET + i, BULLET_DATA, 1);
     }
 
-    BOOM_CONFIG = EBULLET_CONFIG + (NEBULLET * sizeof(vga_mode4_sprite_t));
-    xram0_struct_set(BOOM_CONFIG, vga_mode4_sprite_t, x_pos_px, -16); // Off-screen initially
-    xram0_struct_set(BOOM_CONFIG, vga_mode4_sprite_t, y_pos_px, -16); 
-    xram0_struct_set(BOOM_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, BOOM_DATA); // Enemy Bullet sprite data -- same as player bullet
-    xram0_struct_set(BOOM_CONFIG, vga_mode4_sprite_t, log_size, 4);  // 16x16 sprite (2^4) 
-    xram0_struct_set(BOOM_CONFIG, vga_mode4_sprite_t, has_opacity_metadata, false);
-
-    BALLOON_BOTTOM_CONFIG = BOOM_CONFIG + sizeof(vga_mode4_sprite_t);
-    xram0_struct_set(BALLOON_BOTTOM_CONFIG, vga_mode4_sprite_t, x_pos_px, -16); // Off-screen initially
-    xram0_struct_set(BALLOON_BOTTOM_CONFIG, vga_mode4_sprite_t, y_pos_px, -16); 
-    xram0_struct_set(BALLOON_BOTTOM_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, BALLOON_DATA); // Balloon sprite data
-    xram0_struct_set(BALLOON_BOTTOM_CONFIG, vga_mode4_sprite_t, log_size, 4);  // 16x16 sprite (2^4) 
-    xram0_struct_set(BALLOON_BOTTOM_CONFIG, vga_mode4_sprite_t, has_opacity_metadata, false);
-
-    BALLOON_TOP_CONFIG = BALLOON_BOTTOM_CONFIG + sizeof(vga_mode4_sprite_t);
-    xram0_struct_set(BALLOON_TOP_CONFIG, vga_mode4_sprite_t, x_pos_px, -16); // Off-screen initially
-    xram0_struct_set(BALLOON_TOP_CONFIG, vga_mode4_sprite_t, y_pos_px, -16); 
-    xram0_struct_set(BALLOON_TOP_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, (BALLOON_DATA + 1024)); // Balloon sprite data
-    xram0_struct_set(BALLOON_TOP_CONFIG, vga_mode4_sprite_t, log_size, 4);  // 16x16 sprite (2^4) 
-    xram0_struct_set(BALLOON_TOP_CONFIG, vga_mode4_sprite_t, has_opacity_metadata, false);
-
-    JET_LEFT_CONFIG = BALLOON_TOP_CONFIG + sizeof(vga_mode4_sprite_t);
-    xram0_struct_set(JET_LEFT_CONFIG, vga_mode4_sprite_t, x_pos_px, -16); // Off-screen initially
-    xram0_struct_set(JET_LEFT_CONFIG, vga_mode4_sprite_t, y_pos_px, -16); 
-    xram0_struct_set(JET_LEFT_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, JET_DATA); // Jet sprite data
-    xram0_struct_set(JET_LEFT_CONFIG, vga_mode4_sprite_t, log_size, 3);  // 8x8 sprite (2^3) 
-    xram0_struct_set(JET_LEFT_CONFIG, vga_mode4_sprite_t, has_opacity_metadata, false);
-
-    JET_RIGHT_CONFIG = JET_LEFT_CONFIG + sizeof(vga_mode4_sprite_t);
-    xram0_struct_set(JET_RIGHT_CONFIG, vga_mode4_sprite_t, x_pos_px, -16); // Off-screen initially
-    xram0_struct_set(JET_RIGHT_CONFIG, vga_mode4_sprite_t, y_pos_px, -16); 
-    xram0_struct_set(JET_RIGHT_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, (JET_DATA + 128)); // Jet sprite data
-    xram0_struct_set(JET_RIGHT_CONFIG, vga_mode4_sprite_t, log_size, 3);  // 8x8 sprite (2^3) 
-    xram0_struct_set(JET_RIGHT_CONFIG, vga_mode4_sprite_t, has_opacity_metadata, false);
-
-    BOMB_CONFIG = JET_RIGHT_CONFIG + sizeof(vga_mode4_sprite_t);
-    xram0_struct_set(BOMB_CONFIG, vga_mode4_sprite_t, x_pos_px, -16); // Off-screen initially
-    xram0_struct_set(BOMB_CONFIG, vga_mode4_sprite_t, y_pos_px, -16); 
-    xram0_struct_set(BOMB_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, BOMB_DATA); // Bomb sprite data
-    xram0_struct_set(BOMB_CONFIG, vga_mode4_sprite_t, log_size, 3);  // 8x8 sprite (2^3) 
-    xram0_struct_set(BOMB_CONFIG, vga_mode4_sprite_t, has_opacity_metadata, false);
-
-    JET_BULLET_CONFIG = BOMB_CONFIG + sizeof(vga_mode4_sprite_t);
-    xram0_struct_set(JET_BULLET_CONFIG, vga_mode4_sprite_t, x_pos_px, -16); // Off-screen initially
-    xram0_struct_set(JET_BULLET_CONFIG, vga_mode4_sprite_t, y_pos_px, -16);
-    xram0_struct_set(JET_BULLET_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, BULLET_DATA); // Jet Bullet sprite data
-    xram0_struct_set(JET_BULLET_CONFIG, vga_mode4_sprite_t, log_size, 1);  // 4x4 sprite (2^1)
-    xram0_struct_set(JET_BULLET_CONFIG, vga_mode4_sprite_t, has_opacity_metadata, false);
-
-    JET_BOMB_CONFIG = JET_BULLET_CONFIG + sizeof(vga_mode4_sprite_t);
-    xram0_struct_set(JET_BOMB_CONFIG, vga_mode4_sprite_t, x_pos_px, -16); // Off-screen initially
-    xram0_struct_set(JET_BOMB_CONFIG, vga_mode4_sprite_t, y_pos_px, -16);
-    xram0_struct_set(JET_BOMB_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, BOMB_DATA); // Jet Bomb sprite data
-    xram0_struct_set(JET_BOMB_CONFIG, vga_mode4_sprite_t, log_size, 3);  // 8x8 sprite (2^2)
-    xram0_struct_set(JET_BOMB_CONFIG, vga_mode4_sprite_t, has_opacity_metadata, false);
-
-    MINICHOPPER_CONFIG = JET_BOMB_CONFIG + sizeof(vga_mode4_sprite_t);
+    init_sprite(SPR_BOOM, BOOM_DATA, 4);
+    init_sprite(SPR_BALLOON_BOTTOM, BALLOON_DATA, 4);
+    init_sprite(SPR_BALLOON_TOP, (BALLOON_DATA + 1024), 4);
+    init_sprite(SPR_JET_LEFT, JET_DATA, 3);
+    init_sprite(SPR_JET_RIGHT, (JET_DATA + 128), 3);
+    init_sprite(SPR_BOMB, BOMB_DATA, 3);
+    init_sprite(SPR_JET_BULLET, BULLET_DATA, 1);
+    init_sprite(SPR_JET_BOMB, BOMB_DATA, 3);
+
     for (int i = 0; i < LIVES_STARTING; i++) {
-        unsigned minichopper_cfg = MINICHOPPER_CONFIG + (i * sizeof(vga_mode4_sprite_t));
-        xram0_struct_set(minichopper_cfg, vga_mode4_sprite_t, x_pos_px, -16); // Off-screen initially
-        xram0_struct_set(minichopper_cfg, vga_mode4_sprite_t, y_pos_px, -16);
-        xram0_struct_set(minichopper_cfg, vga_mode4_sprite_t, xram_sprite_ptr, MINICHOPPER_DATA); // Mini Chopper sprite data
-        xram0_struct_set(minichopper_cfg, vga_mode4_sprite_t, log_size, 3);  // 8x8 sprite (2^3)
-        xram0_struct_set(minichopper_cfg, vga_mode4_sprite_t, has_opacity_metadata, false);
+        init_sprite(SPR_MINICHOPPER + i, MINICHOPPER_DATA, 3);
     }
 
-    xregn(1, 0, 1, 5, 4, 0, CHOPPER_LEFT_CONFIG, 2 + NUM_HOSTAGES + NUM_BULLETS + 2 + MAX_EXPLOSIONS + total_tank_sprites + NEBULLET + 8 + LIVES_STARTING, 2); // Enable sprites
-
-    unsigned FOREGROUND_SPRITE_END = MINICHOPPER_CONFIG + (LIVES_STARTING * sizeof(vga_mode4_sprite_t));
-
-
     // -----------------------------------------------------
     // SETUP CLOUDS
     // -----------------------------------------------------
@@ -273,226 +132,69 @@ static void init_graphics(void)
         
         // Random Height
         // cloud_y[i] = (rand() % (MAX_CLOUD_Y - MIN_CLOUD_Y)) + MIN_CLOUD_Y;
-        int32_t screen_pos = ((i * 60) << SUBPIXEL_BITS) + MIN_CLOUD_Y; // Spread screen positions
+        int32_t screen_pos = ((int32_t)(i * 60) << SUBPIXEL_BITS_Y) + MIN_CLOUD_Y; // Spread screen positions
         cloud_y[i] = screen_pos;
 
         // Spread out World X initially (0, 320, 640 approx)
         // screen_pos = (i * 120) << SUBPIXEL_BITS; // Spread screen positions
-        screen_pos = (rand() % SCREEN_WIDTH) << SUBPIXEL_BITS;
+        screen_pos = (int32_t)rng_below16(SCREEN_WIDTH) << SUBPIXEL_BITS;
         cloud_world_x[i] = screen_pos;       // Simple init since camera is 0
-        printf("Cloud %d: world_x=%ld, y=%d, depth_shift=%d\n", i, cloud_world_x[i], cloud_y[i], cloud_depth_shift[i]);
+        printf("Cloud %d: world_x=%ld, y=%u, depth_shift=%d\n", i, cloud_world_x[i], cloud_y[i], cloud_depth_shift[i]);
     }
 
-    CLOUD_A_CONFIG = FOREGROUND_SPRITE_END;
-    CLOUD_B_CONFIG = CLOUD_A_CONFIG + sizeof(vga_mode4_sprite_t);
-    CLOUD_C_CONFIG = CLOUD_B_CONFIG + sizeof(vga_mode4_sprite_t);
-
-    xram0_struct_set(CLOUD_A_CONFIG, vga_mode4_sprite_t, x_pos_px, cloud_world_x[0] >> SUBPIXEL_BITS);
-    xram0_struct_set(CLOUD_A_CONFIG, vga_mode4_sprite_t, y_pos_px, cloud_y[0] >> SUBPIXEL_BITS);
-    xram0_struct_set(CLOUD_A_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, CLOUD_A_DATA);
-    xram0_struct_set(CLOUD_A_CONFIG, vga_mode4_sprite_t, log_size, 5);  // 32x32 sprite (2^5)
-    xram0_struct_set(CLOUD_A_CONFIG, vga_mode4_sprite_t, has_opacity_metadata, false);
-
-    xram0_struct_set(CLOUD_B_CONFIG, vga_mode4_sprite_t, x_pos_px, cloud_world_x[1] >> SUBPIXEL_BITS);
-    xram0_struct_set(CLOUD_B_CONFIG, vga_mode4_sprite_t, y_pos_px, cloud_y[1] >> SUBPIXEL_BITS);
-    xram0_struct_set(CLOUD_B_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, CLOUD_B_DATA);
-    xram0_struct_set(CLOUD_B_CONFIG, vga_mode4_sprite_t, log_size, 5);  // 32x32 sprite (2^5)
-    xram0_struct_set(CLOUD_B_CONFIG, vga_mode4_sprite_t, has_opacity_metadata, false);
-
-    xram0_struct_set(CLOUD_C_CONFIG, vga_mode4_sprite_t, x_pos_px, cloud_world_x[2] >> SUBPIXEL_BITS);
-    xram0_struct_set(CLOUD_C_CONFIG, vga_mode4_sprite_t, y_pos_px, cloud_y[2] >> SUBPIXEL_BITS);
-    xram0_struct_set(CLOUD_C_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, CLOUD_C_DATA);
-    xram0_struct_set(CLOUD_C_CONFIG, vga_mode4_sprite_t, log_size, 4);  // 16x16 sprite (2^4)
-    xram0_struct_set(CLOUD_C_CONFIG, vga_mode4_sprite_t, has_opacity_metadata, false);
-
-    // SETUP LANDING PAD SPRITE
+    init_sprite(SPR_CLOUD + 0, CLOUD_A_DATA, 5);  // 32x32 sprite (2^5)
+    init_sprite(SPR_CLOUD + 1, CLOUD_B_DATA, 5);  // 32x32 sprite (2^5)
+    init_sprite(SPR_CLOUD + 2, CLOUD_C_DATA, 4);  // 16x16 sprite (2^4)
+    for (int i = 0; i < NUM_CLOUDS; i++) {
+        sprite_show(SPR_CLOUD + i, cloud_world_x[i] >> SUBPIXEL_BITS, Y_PX(cloud_y[i]));
+    }
 
-    LANDINGPAD_CONFIG = CLOUD_C_CONFIG + sizeof(vga_mode4_sprite_t);
+    // SETUP LANDING PAD SPRITE (16x16, 512 bytes each)
     for (int i = 0; i < NUM_LANDING_PAD_SPRITE; i++) {
-        unsigned landing_pad_cfg = LANDINGPAD_CONFIG + (i * sizeof(vga_mode4_sprite_t));
-        unsigned data_ptr = LANDINGPAD_DATA + (i * 512); // Each landing pad is 16x16 (512 bytes)
-        xram0_struct_set(landing_pad_cfg, vga_mode4_sprite_t, x_pos_px, -16); // Off-screen initially
-        xram0_struct_set(landing_pad_cfg, vga_mode4_sprite_t, y_pos_px, -16);
-        xram0_struct_set(landing_pad_cfg, vga_mode4_sprite_t, xram_sprite_ptr, data_ptr); // Each landing pad is 16x16 (512 bytes)
-        xram0_struct_set(landing_pad_cfg, vga_mode4_sprite_t, log_size, 4);  // 16x16 sprite (2^4)
-        xram0_struct_set(landing_pad_cfg, vga_mode4_sprite_t, has_opacity_metadata, false);
+        init_sprite(SPR_LANDINGPAD + i, (LANDINGPAD_DATA + (i * 512)), 4);
     }
 
-    // SETUP HOMEBASE SPRITE
-
-    HOMEBASE_CONFIG = LANDINGPAD_CONFIG + (NUM_LANDING_PAD_SPRITE * sizeof(vga_mode4_sprite_t));
+    // SETUP HOMEBASE SPRITE (16x16, 512 bytes each)
     for (int i = 0; i < NUM_HOMEBASE_SPRITE; i++) {
-        unsigned homebase_cfg = HOMEBASE_CONFIG + (i * sizeof(vga_mode4_sprite_t));
-        unsigned data_ptr = HOMEBASE_DATA + (i * 512); // Each home base is 16x16 (512 bytes)
-        xram0_struct_set(homebase_cfg, vga_mode4_sprite_t, x_pos_px, -16); // Off-screen initially
-        xram0_struct_set(homebase_cfg, vga_mode4_sprite_t, y_pos_px, -16);
-        xram0_struct_set(homebase_cfg, vga_mode4_sprite_t, xram_sprite_ptr, data_ptr); // Each home base is 16x16 (512 bytes)
-        xram0_struct_set(homebase_cfg, vga_mode4_sprite_t, log_size, 4);  // 16x16 sprite (2^4)
-        xram0_struct_set(homebase_cfg, vga_mode4_sprite_t, has_opacity_metadata, false);
+        init_sprite(SPR_HOMEBASE + i, (HOMEBASE_DATA + (i * 512)), 4);
     }
 
-    // SET UP ENEMY BASE SPRITE
-
-    ENEMYBASE_CONFIG = HOMEBASE_CONFIG + (NUM_HOMEBASE_SPRITE * sizeof(vga_mode4_sprite_t));
+    // SET UP ENEMY BASE SPRITE (32x32, 2048 bytes each, left/right pairs)
     for (int i = 0; i < NUM_ENEMYBASE_SPRITE; i++) {
-        unsigned enemybase_cfg = ENEMYBASE_CONFIG + (i * sizeof(vga_mode4_sprite_t));
-        unsigned data_ptr = ENEMYBASE_DATA + (i * 2048); // Each enemy base is 32x32 (2048 bytes)
-        xram0_struct_set(enemybase_cfg, vga_mode4_sprite_t, x_pos_px, -32); // Off-screen initially
-        xram0_struct_set(enemybase_cfg, vga_mode4_sprite_t, y_pos_px, -32);
-        xram0_struct_set(enemybase_cfg, vga_mode4_sprite_t, xram_sprite_ptr, data_ptr); // Each enemy base is 32x32 (2048 bytes)
-        xram0_struct_set(enemybase_cfg, vga_mode4_sprite_t, log_size, 5);  // 32x32 sprite (2^5)
-        xram0_struct_set(enemybase_cfg, vga_mode4_sprite_t, has_opacity_metadata, false);
+        init_sprite(SPR_ENEMYBASE + i, (ENEMYBASE_DATA + ((i & 1) * 2048)), 5);
     }
 
     // SET UP FLAG SPRITE
-    FLAGS_CONFIG = ENEMYBASE_CONFIG + (NUM_ENEMYBASE_SPRITE * sizeof(vga_mode4_sprite_t));
-    xram0_struct_set(FLAGS_CONFIG, vga_mode4_sprite_t, x_pos_px, -16); // Off-screen initially
-    xram0_struct_set(FLAGS_CONFIG, vga_mode4_sprite_t, y_pos_px, -16);
-    xram0_struct_set(FLAGS_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, FLAGS_DATA);
-    xram0_struct_set(FLAGS_CONFIG, vga_mode4_sprite_t, log_size, 4);  // 16x16 sprite (2^4)
-    xram0_struct_set(FLAGS_CONFIG, vga_mode4_sprite_t, has_opacity_metadata, false);
+    init_sprite(SPR_FLAGS, FLAGS_DATA, 4);
 
-    xregn(1, 0, 1, 5, 4, 0, CLOUD_A_CONFIG, NUM_CLOUDS + NUM_LANDING_PAD_SPRITE + NUM_HOMEBASE_SPRITE + NUM_ENEMYBASE_SPRITE + NUM_FLAGS, 1); // Enable sprite
-
-    unsigned END_OF_SPRITES = FLAGS_CONFIG + (NUM_FLAGS * sizeof(vga_mode4_sprite_t));
-
-    // Sky Map
-    GROUND_MAP_START = END_OF_SPRITES; // Sky Background Configuration
-    GROUND_MAP_END   = (GROUND_MAP_START + GROUND_MAP_SIZE);
+    // Write the visible records and enable both sprite planes with
+    // just the live count (flush_sprites re-issues xregn as it changes)
+    flush_sprites();
 
     // -----------------------------------------------------
-    // 3. FILL GROUND MAP (Plane 2 - Data)
+    // GROUND AND TEXT PLANES
     // -----------------------------------------------------
-
-    RIA.addr0 = GROUND_MAP_START;
-
-    RIA.step0 = 1;
-
-    for (int y = 0; y < 15; y++) {
-        for (int x = 0; x < 20; x++) {
-            uint8_t tile_id = 0; // Default Transparent (if Color 0 is alpha)
-
-            // Ground Logic
-            if (y >= 12) {
-                tile_id = 1; // Solid Ground
-            }
-            else if (y == 11) {
-                // Mountain Range (2-9)
-                tile_id = 2 + (x % 8);
-            }
-            
-            RIA.rw0 = tile_id;
-        }
-    }
-
-    GROUND_CONFIG = GROUND_MAP_END;
-
-    // // -----------------------------------------------------
-    // // 2. CONFIGURE PLANE 2 (The Background)
-    // // -----------------------------------------------------
-    // // We write to the address GROUND_CONFIG
-
-
-    xram0_struct_set(GROUND_CONFIG, vga_mode2_config_t, x_wrap, true);
-    xram0_struct_set(GROUND_CONFIG, vga_mode2_config_t, y_wrap, true);
-    xram0_struct_set(GROUND_CONFIG, vga_mode2_config_t, x_pos_px, 0);
-    xram0_struct_set(GROUND_CONFIG, vga_mode2_config_t, y_pos_px, 0);
-    xram0_struct_set(GROUND_CONFIG, vga_mode2_config_t, width_tiles, 20);
-    xram0_struct_set(GROUND_CONFIG, vga_mode2_config_t, height_tiles, 15);
-    xram0_struct_set(GROUND_CONFIG, vga_mode2_config_t, xram_data_ptr, GROUND_MAP_START);
-    xram0_struct_set(GROUND_CONFIG, vga_mode2_config_t, xram_palette_ptr, PALETTE_ADDR);
-    xram0_struct_set(GROUND_CONFIG, vga_mode2_config_t, xram_tile_ptr, GROUND_DATA);
-
+    // The ground map, both plane configs and the cleared text buffer are
+    // prebuilt by tools/xram_config.py and loaded straight into XRAM with
+    // the ROM (GROUND_MAP_START .. TEXT_STORAGE_END). All that is left to do
+    // here is point the VGA planes at them.
 
     // Enable Plane 2 (Background) at Register 9
     // Args: dev(1), chan(0), reg(9), count(3), mode(2), options(0), config_addr
     xregn(1, 0, 1, 4, 2, 10, GROUND_CONFIG, 0); // Enable sprite
 
-    TEXT_CONFIG = GROUND_CONFIG + sizeof(vga_mode2_config_t);
-    text_message_addr = TEXT_CONFIG + sizeof(vga_mode1_config_t);
-    const unsigned bytes_per_char = 3; // we write 3 bytes per character into text RAM
-    unsigned text_storage_end = text_message_addr + MESSAGE_LENGTH * bytes_per_char;
-
-
-    xram0_struct_set(TEXT_CONFIG, vga_mode1_config_t, x_wrap, 0);
-    xram0_struct_set(TEXT_CONFIG, vga_mode1_config_t, y_wrap, 0);
-    xram0_struct_set(TEXT_CONFIG, vga_mode1_config_t, x_pos_px, 0); //Bug: first char duplicated if not set to zero
-    xram0_struct_set(TEXT_CONFIG, vga_mode1_config_t, y_pos_px, 5);
-    xram0_struct_set(TEXT_CONFIG, vga_mode1_config_t, width_chars, MESSAGE_WIDTH);
-    xram0_struct_set(TEXT_CONFIG, vga_mode1_config_t, height_chars, MESSAGE_HEIGHT);
-    xram0_struct_set(TEXT_CONFIG, vga_mode1_config_t, xram_data_ptr, text_message_addr);
-    xram0_struct_set(TEXT_CONFIG, vga_mode1_config_t, xram_palette_ptr, 0xFFFF);
-    xram0_struct_set(TEXT_CONFIG, vga_mode1_config_t, xram_font_ptr, 0xFFFF);
-
     // 4 parameters: text mode, 8-bit, config, plane
     xregn(1, 0, 1, 4, 1, 3, TEXT_CONFIG, 2);
 
-    // Clear message buffer to spaces
+    // Clear message buffer to spaces (text RAM already matches)
     for (int i = 0; i < MESSAGE_LENGTH; ++i) message[i] = ' ';
 
-    // Now write the MESSAGE_LENGTH characters into text RAM (3 bytes per char)
-    RIA.addr0 = text_message_addr;
-    RIA.step0 = 1;
-    for (uint16_t i = 0; i < MESSAGE_LENGTH; i++) {
-        RIA.rw0 = ' ';
-        RIA.rw0 = HUD_COL_WHITE;
-        RIA.rw0 = HUD_COL_BG;
-    }
-
-    printf("Chopper Data at 0x%04X\n", CHOPPER_DATA);
-    printf("Ground Data at 0x%04X\n", GROUND_DATA);
-    printf("Cloud A Data at 0x%04X\n", CLOUD_A_DATA);
-    printf("Cloud B Data at 0x%04X\n", CLOUD_B_DATA);
-    printf("Cloud C Data at 0x%04X\n", CLOUD_C_DATA);
-    printf("Landing Pad Data at 0x%04X\n", LANDINGPAD_DATA);
-    printf("Homebase Data at 0x%04X\n", HOMEBASE_DATA);
-    printf("Enemybase Data at 0x%04X\n", ENEMYBASE_DATA);
-    printf("Flags Data at 0x%04X\n", FLAGS_DATA);
-    printf("Hostages Data at 0x%04X\n", HOSTAGES_DATA);
-    printf("Bullet Data at 0x%04X\n", BULLET_DATA);
-    printf("Explosion Data at 0x%04X\n", EXPLOSION_DATA);
-    printf("Small Explosion Data at 0x%04X\n", SMALL_EXPLOSION_DATA);
-    printf("Tank Data at 0x%04X\n", TANK_DATA);
-    printf("Boom Data at 0x%04X\n", BOOM_DATA);
-    printf("Balloon Data at 0x%04X\n", BALLOON_DATA);
-    printf("Jet Data at 0x%04X\n", JET_DATA);
-    printf("Bomb Data at 0x%04X\n", BOMB_DATA);
-    printf("Chopper Left Sprite Config at 0x%04X\n", CHOPPER_LEFT_CONFIG);
-    printf("Chopper Right Sprite Config at 0x%04X\n", CHOPPER_RIGHT_CONFIG);
-    printf("Hostage Sprite Config at 0x%04X\n", HOSTAGE_CONFIG);
-    printf("Bullet Sprite Config at 0x%04X\n", BULLET_CONFIG);
-    printf("Explosion Left Sprite Config at 0x%04X\n", EXPLOSION_LEFT_CONFIG);
-    printf("Explosion Right Sprite Config at 0x%04X\n", EXPLOSION_RIGHT_CONFIG);
-    printf("Small Explosion Sprite Config at 0x%04X\n", SMALL_EXPLOSION_CONFIG);
-    printf("Tank Sprite Config at 0x%04X\n", TANK_CONFIG);
-    printf("Enemy Bullet Sprite Config at 0x%04X\n", EBULLET_CONFIG);
-    printf("Boom Sprite Config at 0x%04X\n", BOOM_CONFIG);
-    printf("Balloon Bottom Sprite Config at 0x%04X\n", BALLOON_BOTTOM_CONFIG);
-    printf("Balloon Top Sprite Config at 0x%04X\n", BALLOON_TOP_CONFIG);
-    printf("Jet Left Sprite Config at 0x%04X\n", JET_LEFT_CONFIG);
-    printf("Jet Right Sprite Config at 0x%04X\n", JET_RIGHT_CONFIG);
-    printf("Bomb Sprite Config at 0x%04X\n", BOMB_CONFIG);
-    printf("Jet Bullet Sprite Config at 0x%04X\n", JET_BULLET_CONFIG);
-    printf("Jet Bomb Sprite Config at 0x%04X\n", JET_BOMB_CONFIG);
-    printf("CLOUD_A_CONFIG=0x%X\n", CLOUD_A_CONFIG);
-    printf("CLOUD_B_CONFIG=0x%X\n", CLOUD_B_CONFIG);
-    printf("CLOUD_C_CONFIG=0x%X\n", CLOUD_C_CONFIG);
-    printf("LANDINGPAD_CONFIG=0x%X\n", LANDINGPAD_CONFIG);
-    printf("HOMEBASE_CONFIG=0x%X\n", HOMEBASE_CONFIG);
-    printf("ENEMYBASE_CONFIG=0x%X\n", ENEMYBASE_CONFIG);
-    printf("FLAGS_CONFIG=0x%X\n", FLAGS_CONFIG);
-    printf("END OF SPRITES=0x%X\n", END_OF_SPRITES);
-    printf("Ground Map Start at 0x%04X\n", GROUND_MAP_START);
-    printf("Ground Map End at 0x%04X\n", GROUND_MAP_END);
-    printf("Ground Background Config at 0x%04X\n", GROUND_CONFIG);
-    printf("TEXT_CONFIG=0x%X\n", TEXT_CONFIG);
-    printf("Text Message Addr=0x%X\n", text_message_addr);
-
-     printf("Next Free XRAM Address: 0x%04X\n", text_storage_end);
-
-    printf("  GAME_PAD_CONFIG=0x%X\n", GAMEPAD_INPUT);
-    printf("  KEYBOARD_CONFIG=0x%X\n", KEYBOARD_INPUT);
-    printf("  PSG_CONFIG=0x%X\n", PSG_XRAM_ADDR);
+    // Whole XRAM map, straight from the generated layout
+#define PRINT_XRAM_REGION(addr, size, label) \
+    printf("%-22s 0x%04X-0x%04X\n", label, (unsigned)(addr), (unsigned)((addr) + (size) - 1));
+    XRAM_LAYOUT_REGIONS(PRINT_XRAM_REGION)
+#undef PRINT_XRAM_REGION
+    printf("Next Free XRAM Address: 0x%04X (%u bytes)\n", XRAM_FREE_START, XRAM_FREE_SIZE);
 
 }
 
@@ -506,16 +208,16 @@ void init_game_logic(void) {
     // 2. Reset Hostages & Clear Sprites
     for (int i = 0; i < NUM_HOSTAGES; i++) {
         // Reset Logic
-        hostages[i].state = H_STATE_INACTIVE;
-        hostages[i].world_x = 0; 
-        hostages[i].y = GROUND_Y_SUB - (16 << SUBPIXEL_BITS);
+        hostage_state[i] = H_STATE_INACTIVE;
+        hostage_x[i] = 0; 
+        hostage_y[i] = GROUND_Y_SUB - (16 << SUBPIXEL_BITS_Y);
         
         // --- FIX: CLEAR HARDWARE SPRITES ---
         // Move them off-screen immediately so they don't linger
-        unsigned cfg = HOSTAGE_CONFIG + (i * sizeof(vga_mode4_sprite_t));
-        xram0_struct_set(cfg, vga_mode4_sprite_t, x_pos_px, -32);
-        xram0_struct_set(cfg, vga_mode4_sprite_t, y_pos_px, -32);
+        sprite_hide(SPR_HOSTAGE + i);
     }
+    pool_init(&hostage_pool, NUM_HOSTAGES);
+    reset_hostage_crowd();
 
     // 3. Reset Bases
     for (int i = 0; i < NUM_ENEMY_BASES; i++) {
@@ -529,10 +231,10 @@ void init_game_logic(void) {
         base_state[i].tank_cooldown = 0;
     }
 
-    // Reset Active Tank Pool
-    for (int t = 0; t < NUM_TANKS; t++) {
-        tanks[t].active = false;
-    }
+    // Reset Active Tank Pool and the shots/debris in flight
+    pool_init(&tank_pool, NUM_TANKS);
+    reset_tank_bullets();
+    reset_small_explosions();
 
     // 4. Reset Booms 
     reset_boom();
@@ -571,8 +273,6 @@ static bool title_input_lock = false;
 // Title Screen indicator
 bool is_title_screen = false;
 
-uint8_t anim_timer = 0;
-
 int main(void)
 {
 
@@ -585,11 +285,15 @@ int main(void)
     // Enable gamepad input
     xregn(0, 0, 2, 1, GAMEPAD_INPUT);
 
+    rng_seed(RNG_DEFAULT_SEED); // Same seed every boot, so runs replay
     init_graphics();
     init_game_logic();
+    init_world_view(); // Caches base positions in pixels
+    init_terrain(); // Streams in the mountains around the camera
     init_input_system(); // Initialize input mappings (ensure `button_mappings` are set)
     init_psg(); // Initialize PSG sound system
     init_music(); // Initialize music system
+    profile_init(); // No-op unless built with PROFILE
 
     // Draw initial Title Screen
     clear_text_screen();
@@ -603,22 +307,33 @@ int main(void)
     start_title_music();
 
     uint8_t vsync_last = RIA.vsync;
+    uint8_t timed_state = game_state;   // State the timed iteration ran in
 
-    anim_timer = 0;
     uint8_t blade_frame = 0;
+    bool stats_key_held = false;
 
 
     while (1)
     {
         // Main game loop
         // For now, just wait for VBlank
-        if (RIA.vsync == vsync_last)
+        uint8_t vsync_now = RIA.vsync;
+        if (vsync_now == vsync_last)
             continue;
-        vsync_last = RIA.vsync;
+
+        // More than one vsync since last time means the last frame overran.
+        // Charge it to the state that iteration ran, which may have just
+        // changed (PLAYING -> GAME OVER, say)
+        frame_stats_update((uint8_t)(vsync_now - vsync_last), timed_state);
+        vsync_last = vsync_now;
+        timed_state = game_state;
 
         // Handle input
         handle_input();
 
+        // Hitboxes are registered afresh by the updates below
+        collision_begin();
+
         switch (game_state) {
             // --- TITLE SCREEN ---
             case STATE_TITLE:
@@ -626,6 +341,7 @@ int main(void)
                 is_title_screen = true;
 
                 update_chopper_state();
+                update_world_view();
                 update_music();
                 update_clouds();
                 update_landing();
@@ -641,25 +357,27 @@ int main(void)
 
                 // Cycle "PRESS START" colors
                 // Speed: Change color every 8 frames (~0.13s)
-                const uint8_t ps_colors[] = { 
-                    HUD_COL_WHITE, 
-                    HUD_COL_YELLOW, 
-                    HUD_COL_CYAN, 
-                    HUD_COL_GREEN, 
-                    HUD_COL_MAGENTA, 
-                    HUD_COL_RED 
-                };
-                
-                // Calculate index: (Time / Speed) % Count
-                int color_idx = (RIA.vsync / 8) % 6; 
-                draw_text(4, 11, "PRESS START", ps_colors[color_idx]);
+                {
+                    const uint8_t ps_colors[] = { 
+                        HUD_COL_WHITE, 
+                        HUD_COL_YELLOW, 
+                        HUD_COL_CYAN, 
+                        HUD_COL_GREEN, 
+                        HUD_COL_MAGENTA, 
+                        HUD_COL_RED 
+                    };
+                    
+                    // Calculate index: (Time / Speed) % Count
+                    int color_idx = (RIA.vsync / 8) % 6; 
+                    draw_text(4, 11, "PRESS START", ps_colors[color_idx]);
+                }
 
 
                 if (!title_input_lock && is_any_input_pressed()) {
                     // Reset idle timer if player is mashing buttons
                     input_idle_timer = 0;
 
-                    if (is_action_pressed(0, ACTION_PAUSE) || is_action_pressed(0, ACTION_FIRE)) {
+                    if (action_held[0] & (ACTION_BIT(ACTION_PAUSE) | ACTION_BIT(ACTION_FIRE))) {
                         
                         // Reset Game
                         init_game_logic(); // Resets hostages, bases, etc.
@@ -713,9 +431,6 @@ int main(void)
 
                 is_title_screen = false;
 
-                // Update animation frames
-                anim_timer++;
-
                 // 1. Handle IDLE / DEMO EXIT Logic
                 if (is_any_input_pressed()) {
                     input_idle_timer = 0;
@@ -761,43 +476,46 @@ int main(void)
                 }
 
                 // Update player state
-                update_chopper_state();
+                PROFILE_CALL(PROF_CHOPPER, update_chopper_state());
+                // Camera has moved: refresh the shared per-frame queries
+                update_world_view();
                 // Update clouds
-                update_clouds();
+                PROFILE_CALL(PROF_CLOUDS, update_clouds());
                 // Update landing pad
-                update_landing();
+                PROFILE_CALL(PROF_LANDING, update_landing());
                 // Update home base
-                update_homebase();
+                PROFILE_CALL(PROF_HOMEBASE, update_homebase());
                 // Update flags
-                update_flags();
+                PROFILE_CALL(PROF_FLAGS, update_flags());
                 // Update enemy base
-                update_enemybase();
+                PROFILE_CALL(PROF_ENEMYBASE, update_enemybase());
                 // Update balloon 
-                update_balloon();
+                PROFILE_CALL(PROF_BALLOON, update_balloon());
                 // Update boom
-                update_boom();
+                PROFILE_CALL(PROF_BOOM, update_boom());
                 // Update bullets
-                update_bullet();
-                // Check bullet collisions
-                check_bullet_collisions();
+                PROFILE_CALL(PROF_BULLET, update_bullet());
                 // Update enemy bullets
-                update_tank_bullets();
+                PROFILE_CALL(PROF_EBULLETS, update_tank_bullets());
                 // Update bombs
-                update_bomb();
+                PROFILE_CALL(PROF_BOMB, update_bomb());
                 // Update hostages
-                update_hostages();
+                PROFILE_CALL(PROF_HOSTAGES, update_hostages());
                 // Update explosion
-                update_explosion();
+                PROFILE_CALL(PROF_EXPLOSION, update_explosion());
                 // Update small explosion
-                update_small_explosions();
+                PROFILE_CALL(PROF_SMALL_EXPLOSION, update_small_explosions());
                 // Update tanks
-                update_tanks();
+                PROFILE_CALL(PROF_TANKS, update_tanks());
                 // Update Jet
-                update_jet();
+                PROFILE_CALL(PROF_JET, update_jet());
+
+                // Resolve every hitbox registered above in one pass
+                PROFILE_CALL(PROF_COLLISIONS, collision_run());
 
                 // Update HUD
-                update_hud();
-                update_lives_display(); // Show remaining lives
+                PROFILE_CALL(PROF_HUD, update_hud());
+                PROFILE_CALL(PROF_LIVES, update_lives_display()); // Show remaining lives
 
                 // --- SORTIE MESSAGE LOGIC ---
                 if (sortie_msg_active) {
@@ -868,6 +586,10 @@ int main(void)
                         
                         enter_initials(hostages_rescued_count, hostages_lost_count);
                         clear_text_screen(); // Clear the entry UI
+
+                        // enter_initials() ran its own vsync loop for seconds:
+                        // time the rest of this frame from here, not as a stall
+                        vsync_last = RIA.vsync;
                     }
 
                     center_text(7, "GAME OVER", HUD_COL_RED);
@@ -892,9 +614,23 @@ int main(void)
                 break;
         }
 
+        // Push this frame's sprite changes to XRAM in one pass
+        flush_sprites();
+
+        // Report subsystem timings every PROFILE_WINDOW frames (PROFILE builds)
+        profile_end_frame();
+
+        // Dump frame pacing stats on the console (once per press)
+        if (key(FRAME_STATS_KEY)) {
+            if (!stats_key_held) frame_stats_report();
+            stats_key_held = true;
+        } else {
+            stats_key_held = false;
+        }
 
         // Check for ESC key to exit
         if (key(KEY_ESC)) {
+            frame_stats_report();
             printf("Exiting game...\n");
             break;
         }
@@ -0,0 +1,53 @@
+#include <rp6502.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "constants.h"
+#include "sprites.h"
+#include "metasprite.h"
+
+void metasprite_init(MetaSprite *m, uint8_t first_slot)
+{
+    m->first_slot = first_slot;
+    m->drawn = 0;
+    m->frame = NULL;
+}
+
+void metasprite_draw(MetaSprite *m, const MetaFrame *f, int16_t x, int16_t y)
+{
+    // Someone hid our sprites behind our back (e.g. a range hide on reset),
+    // so nothing we remember is on screen any more
+    if (m->drawn && !sprite_visible[m->first_slot]) {
+        m->drawn = 0;
+    }
+
+    bool new_frame = (f != m->frame) || !m->drawn;
+    if (!new_frame && x == m->x && y == m->y) return;
+
+    const MetaPart *p = f->parts;
+    uint8_t slot = m->first_slot;
+
+    for (uint8_t i = 0; i < f->count; i++, p++, slot++) {
+        if (new_frame) {
+            sprite_set(slot, xram_sprite_ptr, p->ptr);
+        }
+        sprite_show(slot, x + p->dx, y + p->dy);
+    }
+
+    // This frame has fewer parts than the last one
+    if (f->count < m->drawn) {
+        sprite_hide_range(slot, m->drawn - f->count);
+    }
+
+    m->drawn = f->count;
+    m->frame = f;
+    m->x = x;
+    m->y = y;
+}
+
+void metasprite_hide(MetaSprite *m)
+{
+    if (!m->drawn) return;
+    sprite_hide_range(m->first_slot, m->drawn);
+    m->drawn = 0;
+}
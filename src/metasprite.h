@@ -0,0 +1,48 @@
+#ifndef METASPRITE_H
+#define METASPRITE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ============================================================================
+// METASPRITES
+// ============================================================================
+// A metasprite is one on-screen object drawn with several hardware sprites
+// (the tank is a row of five body tiles with four turret tiles on top).
+// Each animation frame is a list of parts, every part being a sprite data
+// pointer plus a pixel offset from the object's top-left corner. The frame
+// tables are generated by tools/luts.py (see TANK_META in luts.h).
+//
+// A MetaSprite instance owns a fixed run of sprite slots and remembers what
+// it last drew. metasprite_draw() does nothing if neither the frame nor the
+// position changed, re-places the parts if only the position moved, and only
+// re-points them when the frame itself changes.
+
+typedef struct {
+    int8_t dx;              // Pixel offset from the object's x
+    int8_t dy;              // Pixel offset from the object's y
+    uint16_t ptr;           // Sprite data in XRAM
+} MetaPart;
+
+typedef struct {
+    uint8_t count;          // Parts in this frame
+    const MetaPart *parts;
+} MetaFrame;
+
+typedef struct {
+    uint8_t first_slot;     // First of this instance's sprite slots
+    uint8_t drawn;          // Parts currently shown (0 = hidden)
+    const MetaFrame *frame; // Frame last drawn
+    int16_t x, y;           // Screen position last drawn
+} MetaSprite;
+
+// Attach an instance to its slots (starts out hidden)
+extern void metasprite_init(MetaSprite *m, uint8_t first_slot);
+
+// Draw frame f with its top-left corner at screen (x, y)
+extern void metasprite_draw(MetaSprite *m, const MetaFrame *f, int16_t x, int16_t y);
+
+// Hide every part (no-op if already hidden)
+extern void metasprite_hide(MetaSprite *m);
+
+#endif // METASPRITE_H
@@ -183,12 +183,11 @@ static void set_note(uint8_t channel, uint16_t freq, uint8_t instrument)
         return;
     }
     
-    // Set frequency (Hz * 3)
-    uint16_t freq_val = freq * 3;
+    // Set frequency (NOTE_* values are already PSG units)
     RIA.addr0 = psg_addr;
     RIA.step0 = 1;
-    RIA.rw0 = freq_val & 0xFF;          // freq low byte
-    RIA.rw0 = (freq_val >> 8) & 0xFF;   // freq high byte
+    RIA.rw0 = freq & 0xFF;              // freq low byte
+    RIA.rw0 = (freq >> 8) & 0xFF;       // freq high byte
     
     // Configure based on instrument type
     if (instrument == INSTRUMENT_HIHAT) {
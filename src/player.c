@@ -11,6 +11,10 @@
 #include "jet.h"
 #include "sound.h"
 #include "boom.h"
+#include "sprites.h"
+#include "collision.h"
+#include "luts.h"
+#include "terrain.h"
 
 extern bool is_title_screen;
 
@@ -27,7 +31,7 @@ int32_t camera_x = ((int32_t)CHOPPER_START_POS << SUBPIXEL_BITS) - (144 << SUBPI
 // Positions are now stored as Sub-Pixels
 int16_t chopper_xl = CHOPPER_START_POS_XL << SUBPIXEL_BITS;  // This tracks our on-screen X position
 int16_t chopper_xr = (CHOPPER_START_POS_XL +16) << SUBPIXEL_BITS; // Right side is 16 pixels to the right
-int16_t chopper_y = GROUND_Y_SUB; // (SCREEN_HEIGHT / 2) << SUBPIXEL_BITS;
+uint16_t chopper_y = GROUND_Y_SUB; // 8.8, see SUBPIXEL_BITS_Y
 
 int16_t chopper_frame = 0; // Current frame index (0-21)
 
@@ -36,40 +40,26 @@ ChopperHeading current_heading = FACING_LEFT;
 int8_t  turn_timer = 0;       // Counts how long we hold a direction to turn
 int16_t velocity_x = 0;
 uint8_t blade_frame = 0;      // 0 or 1 (Animation toggle)
-uint8_t anim_clock = 0;       // Timer for blade speed
+static AnimCursor blade_anim; // ANIM_CHOPPER_BLADES, sets blade_frame
+static int8_t drawn_frame = -1; // CHOPPER_SPRITE_PTR frame the sprites point at
 bool is_turning = false;     // Are we currently rotating?
 int8_t next_heading = 0;     // Where are we trying to go?
 
-// Track the button state to prevent "machine gun" toggling when holding it
-bool btn2_last_state = false;
-
 // Track where we came from so we know which way to turn next
 // -1 = Came from Left, 1 = Came from Right
 int8_t last_side_facing = -1;
 
-// Helper to calculate the memory offset for a specific animation frame
-// frame_idx: 0 to 21
-// part: 0 = Left Half, 1 = Right Half
-uint16_t get_chopper_sprite_ptr(int frame_idx, int part) {
-    // Each 16x16 block is 512 bytes (256 pixels * 2 bytes)
-    // Each Full Frame (Left+Right) is 1024 bytes
-    uint16_t frame_offset = frame_idx * 1024;
-    uint16_t part_offset = part * 512;
-    return CHOPPER_DATA + frame_offset + part_offset;
-}
-
 extern bool is_demo_mode;
 
 
 void update_chopper_animation(uint8_t frame)
 {
     // Update the chopper sprite to the specified frame
-    xram0_struct_set(CHOPPER_LEFT_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, get_chopper_sprite_ptr(frame, 0));
-    xram0_struct_set(CHOPPER_RIGHT_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, get_chopper_sprite_ptr(frame, 1));
+    drawn_frame = frame;
+    sprite_set(SPR_CHOPPER_LEFT, xram_sprite_ptr, CHOPPER_SPRITE_PTR[frame][0]);
+    sprite_set(SPR_CHOPPER_RIGHT, xram_sprite_ptr, CHOPPER_SPRITE_PTR[frame][1]);
 }
 
-extern uint8_t anim_timer;
-
 uint8_t base_frame = FRAME_CENTER_IDLE;
 bool is_landed = true;
 
@@ -77,7 +67,7 @@ void respawn_player(void) {
     player_state = PLAYER_ALIVE;
 
     // Ensure Effects are hidden
-    xram0_struct_set(BOOM_CONFIG, vga_mode4_sprite_t, y_pos_px, -32);
+    sprite_hide(SPR_BOOM);
     
     // Reset Position (Home Base)
     chopper_world_x = (int32_t)CHOPPER_START_POS << SUBPIXEL_BITS;
@@ -114,7 +104,7 @@ void kill_player(void) {
     
     // --- SHOW HIT EFFECT (FRAME 0) ---
     int16_t screen_x = ((chopper_world_x - camera_x) >> SUBPIXEL_BITS) + 8;
-    int16_t screen_y = (chopper_y >> SUBPIXEL_BITS) + 4;
+    int16_t screen_y = Y_PX(chopper_y) + 4;
 
     // Use shared function
     trigger_boom(screen_x, screen_y);
@@ -127,11 +117,11 @@ void update_chopper_state(void) {
     // -----------------------------------------------------------
     // 1. GLOBAL ANIMATION TIMERS
     // -----------------------------------------------------------
-    anim_timer++;
-    if (anim_timer > 2) { 
-        anim_timer = 0;
-        blade_frame = !blade_frame;
+    if (!blade_anim.clip) {
+        anim_restart(&blade_anim, &ANIM_CHOPPER_BLADES);
     }
+    anim_step(&blade_anim);
+    blade_frame = anim_cell(&blade_anim);
 
     // =========================================================
     // STATE: ALIVE (Your Existing Logic)
@@ -172,7 +162,7 @@ void update_chopper_state(void) {
         // 2. VERTICAL AI (Bobbing / Hysteresis)
         // ---------------------------------------------------------
         // Target Altitude: 60 pixels from top
-        int16_t target_alt = (60 << SUBPIXEL_BITS);
+        uint16_t target_alt = (60 << SUBPIXEL_BITS_Y);
 
         if (demo_hover_cooldown > 0) {
             // Coasting / Falling Phase
@@ -197,11 +187,12 @@ void update_chopper_state(void) {
             input_right = is_action_pressed(0, ACTION_ROTATE_RIGHT);
             input_up = is_action_pressed(0, ACTION_THRUST);
             input_down = is_action_pressed(0, ACTION_REVERSE_THRUST);
-            input_btn2 = is_action_pressed(0, ACTION_SUPER_FIRE);
+            // Edge only, so holding the button doesn't keep toggling
+            input_btn2 = is_action_just_pressed(0, ACTION_SUPER_FIRE);
         }
         
         // --- TURN LOGIC (Button 2) ---
-        if (input_btn2 && !btn2_last_state && !is_turning && !is_landed) {
+        if (input_btn2 && !is_turning && !is_landed) {
             if (current_heading == FACING_LEFT) {
                 next_heading = FACING_CENTER;
                 last_side_facing = -1;
@@ -217,7 +208,6 @@ void update_chopper_state(void) {
             is_turning = true;
             turn_timer = TURN_DURATION;
         }
-        btn2_last_state = input_btn2;
 
         // Helper: Are we currently touching the ground?
         is_landed = (chopper_y >= GROUND_Y_SUB);
@@ -237,7 +227,7 @@ void update_chopper_state(void) {
             if (velocity_x < 0) velocity_x += FRICTION_RATE;
 
             if (turn_timer == 0) {
-                current_heading = next_heading;
+                current_heading = (ChopperHeading)next_heading;
                 is_turning = false;
             }
         } 
@@ -335,8 +325,9 @@ void update_chopper_state(void) {
         int16_t abs_vx = (velocity_x < 0) ? -velocity_x : velocity_x;
         int16_t abs_vy = 0;
         
-        if (input_up) abs_vy = CLIMB_SPEED;
-        else if (input_down) abs_vy = DIVE_SPEED;
+        // (vertical speeds are 8.8, bring them to velocity_x's 12.4 scale)
+        if (input_up) abs_vy = CLIMB_SPEED >> (SUBPIXEL_BITS_Y - SUBPIXEL_BITS);
+        else if (input_down) abs_vy = DIVE_SPEED >> (SUBPIXEL_BITS_Y - SUBPIXEL_BITS);
         
         // Pass total speed (scaled down to fit 16-bit comfortably if needed)
         // velocity_x is subpixels (e.g. 32).
@@ -354,7 +345,7 @@ void update_chopper_state(void) {
         stop_chopper_sound();
         
         // 1. Gravity (Fall Fast)
-        chopper_y += (3 << SUBPIXEL_BITS); 
+        chopper_y += (3 << SUBPIXEL_BITS_Y); 
         
         // 2. Momentum (Maintain some forward speed)
         chopper_world_x += velocity_x;
@@ -368,11 +359,11 @@ void update_chopper_state(void) {
         // 4. Boom Animation (Flash Effect)
         // if (death_timer == 5) {
         //     // Switch to Boom Frame 1
-        //     xram0_struct_set(BOOM_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, (uint16_t)(BOOM_DATA + 512));
+        //     sprite_set(SPR_BOOM, xram_sprite_ptr, (uint16_t)(BOOM_DATA + 512));
         // }
         // else if (death_timer == 10) {
         //     // Hide Boom
-        //     xram0_struct_set(BOOM_CONFIG, vga_mode4_sprite_t, y_pos_px, -32);
+        //     sprite_hide(SPR_BOOM);
         // }
 
         // 5. Ground Impact
@@ -418,6 +409,12 @@ void update_chopper_state(void) {
         if (camera_x > CAMERA_MAX_X) camera_x = CAMERA_MAX_X;
     }
 
+    // Target for enemy fire and the balloon (camera is final from here on)
+    if (player_state == PLAYER_ALIVE) {
+        collision_add(COL_CHOPPER, 0, WORLD_X16(chopper_world_x), chopper_y);
+        collision_add(COL_CHOPPER_JET_TARGET, 0, WORLD_X16(chopper_world_x), chopper_y);
+    }
+
     // -----------------------------------------------------------
     // HARDWARE UPDATE
     // -----------------------------------------------------------
@@ -425,26 +422,28 @@ void update_chopper_state(void) {
     // Calculate final screen positions
     int16_t hardware_xl = (chopper_world_x - camera_x) >> SUBPIXEL_BITS;
     int16_t hardware_xr = (chopper_world_x - camera_x + 256) >> SUBPIXEL_BITS; // +16px
-    int16_t hardware_y = chopper_y >> SUBPIXEL_BITS;
+    int16_t hardware_y = Y_PX(chopper_y);
 
     // If crashing, hide the chopper sprite so we only see the explosion
     if (player_state == PLAYER_DYING_CRASHING) {
         hardware_y = -32;
     }
 
-    int final_frame_idx = base_frame + blade_frame;
-    uint16_t ptr_offset = final_frame_idx * 1024; 
+    int8_t final_frame_idx = base_frame + blade_frame;
+
+    // Only re-point the halves when the frame changes
+    if (final_frame_idx != drawn_frame) {
+        drawn_frame = final_frame_idx;
+        sprite_set(SPR_CHOPPER_LEFT, xram_sprite_ptr, CHOPPER_SPRITE_PTR[final_frame_idx][0]);
+        sprite_set(SPR_CHOPPER_RIGHT, xram_sprite_ptr, CHOPPER_SPRITE_PTR[final_frame_idx][1]);
+    }
 
     // Left Half
-    xram0_struct_set(CHOPPER_LEFT_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, (uint16_t)(CHOPPER_DATA + ptr_offset));
-    xram0_struct_set(CHOPPER_LEFT_CONFIG, vga_mode4_sprite_t, x_pos_px, hardware_xl);
-    xram0_struct_set(CHOPPER_LEFT_CONFIG, vga_mode4_sprite_t, y_pos_px, hardware_y);
+    sprite_show(SPR_CHOPPER_LEFT, hardware_xl, hardware_y);
 
     // Right Half
-    xram0_struct_set(CHOPPER_RIGHT_CONFIG, vga_mode4_sprite_t, xram_sprite_ptr, (uint16_t)(CHOPPER_DATA + ptr_offset + 512));
-    xram0_struct_set(CHOPPER_RIGHT_CONFIG, vga_mode4_sprite_t, x_pos_px, hardware_xr);
-    xram0_struct_set(CHOPPER_RIGHT_CONFIG, vga_mode4_sprite_t, y_pos_px, hardware_y);
+    sprite_show(SPR_CHOPPER_RIGHT, hardware_xr, hardware_y);
 
-    // Scroll
-    xram0_struct_set(GROUND_CONFIG, vga_mode2_config_t, x_pos_px, -((camera_x/2) >> SUBPIXEL_BITS));
+    // Scroll the ground plane (and stream in its terrain)
+    update_terrain();
 }
@@ -0,0 +1,41 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include "pool.h"
+
+void pool_init(Pool *p, uint8_t size)
+{
+    p->size = size;
+    p->count = 0;
+    p->free_head = 0;
+
+    for (uint8_t i = 0; i < size; i++) {
+        p->next_free[i] = (i + 1 < size) ? i + 1 : POOL_NONE;
+        p->live_pos[i] = POOL_NONE;
+    }
+}
+
+uint8_t pool_alloc(Pool *p)
+{
+    uint8_t slot = p->free_head;
+    if (slot == POOL_NONE) return POOL_NONE;
+
+    p->free_head = p->next_free[slot];
+    p->live_pos[slot] = p->count;
+    p->live[p->count++] = slot;
+    return slot;
+}
+
+void pool_free(Pool *p, uint8_t slot)
+{
+    uint8_t k = p->live_pos[slot];
+    if (k == POOL_NONE) return;
+
+    // Fill the hole with the last live slot
+    uint8_t last = p->live[--p->count];
+    p->live[k] = last;
+    p->live_pos[last] = k;
+
+    p->live_pos[slot] = POOL_NONE;
+    p->next_free[slot] = p->free_head;
+    p->free_head = slot;
+}
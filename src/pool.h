@@ -0,0 +1,50 @@
+#ifndef POOL_H
+#define POOL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ============================================================================
+// FIXED-SIZE ENTITY POOLS
+// ============================================================================
+// Bookkeeping for a pool of entity slots (the entity data itself stays in
+// the module's own per-field arrays, indexed by slot). Free slots are chained
+// through next_free[], so pool_alloc() pops the head and never scans; live
+// slots are packed at the front of live[], so update loops only visit what
+// is alive. pool_free() moves the last live slot into the hole.
+//
+// Update loops walk live[] from the back:
+//
+//     for (uint8_t k = pool.count; k-- > 0; ) {
+//         uint8_t i = pool.live[k];
+//         ...
+//     }
+//
+// That way freeing slot i inside the loop is safe: the slot that moves into
+// position k has already been visited. Freeing any *other* slot mid-loop is
+// not safe.
+
+#define POOL_MAX_SLOTS  16
+#define POOL_NONE       0xFF
+
+typedef struct {
+    uint8_t size;                           // Slots in this pool
+    uint8_t count;                          // Live slots, packed in live[0..count)
+    uint8_t free_head;                      // First free slot, POOL_NONE when full
+    uint8_t next_free[POOL_MAX_SLOTS];      // Free list links (free slots only)
+    uint8_t live[POOL_MAX_SLOTS];           // Live slots, in no particular order
+    uint8_t live_pos[POOL_MAX_SLOTS];       // Slot -> index in live[], POOL_NONE if free
+} Pool;
+
+// Every slot free. Slots come out of a fresh pool in order 0, 1, 2, ...
+extern void pool_init(Pool *p, uint8_t size);
+
+// Take a free slot (POOL_NONE if the pool is full)
+extern uint8_t pool_alloc(Pool *p);
+
+// Give a live slot back (ignored if it is already free)
+extern void pool_free(Pool *p, uint8_t slot);
+
+#define pool_is_live(p, slot)   ((p)->live_pos[(slot)] != POOL_NONE)
+
+#endif // POOL_H
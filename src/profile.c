@@ -0,0 +1,142 @@
+#ifdef PROFILE
+
+#include <rp6502.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "constants.h"
+#include "hud.h"
+#include "profile.h"
+
+// 4-char tags, same order as ProfileSlot
+static const char prof_names[PROF_COUNT][5] = {
+    "CHOP", "CLOU", "LAND", "HOME", "FLAG", "EBAS", "BALN", "BOOM",
+    "BULL", "EBUL", "BOMB", "HOST", "EXPL", "SEXP", "TANK", "JET ",
+    "COLL", "HUD ", "LIVE",
+};
+
+static uint16_t prof_min[PROF_COUNT];
+static uint16_t prof_max[PROF_COUNT];
+static uint32_t prof_sum[PROF_COUNT];
+
+static uint8_t prof_frames = 0;       // Frames collected in this window
+static bool prof_sampled = false;     // Anything timed since the last end_frame
+static uint16_t prof_overhead = 0;    // Cost of an empty PROFILE_CALL
+
+static void profile_reset(void)
+{
+    for (uint8_t i = 0; i < PROF_COUNT; i++) {
+        prof_min[i] = 0xFFFF;
+        prof_max[i] = 0;
+        prof_sum[i] = 0;
+    }
+    prof_frames = 0;
+}
+
+#ifdef PROFILE_CLOCK
+
+uint16_t profile_now(void)
+{
+    return (uint16_t)(PROFILE_CLOCK);
+}
+
+#else
+
+// VIA T1 counts down at PHI2. Read high/low/high so a borrow between the two
+// byte reads can't give us a value 256 cycles off, then flip it to count up.
+uint16_t profile_now(void)
+{
+    uint8_t hi, lo;
+    do {
+        hi = VIA.t1_hi;
+        lo = VIA.t1_lo;
+    } while (hi != VIA.t1_hi);
+    return (uint16_t)~(((uint16_t)hi << 8) | lo);
+}
+
+#endif // PROFILE_CLOCK
+
+void profile_init(void)
+{
+#ifndef PROFILE_CLOCK
+    // T1 free-running (ACR bit 6), PB7 untouched, reload at 0xFFFF
+    VIA.acr = (VIA.acr & 0x3F) | 0x40;
+    VIA.t1l_lo = 0xFF;
+    VIA.t1l_hi = 0xFF;
+    VIA.t1_lo = 0xFF;
+    VIA.t1_hi = 0xFF;     // Writing the high byte starts the timer
+#endif
+
+    // Measure what the bracketing itself costs so we can take it back off
+    uint16_t t = profile_now();
+    prof_overhead = profile_now() - t;
+
+    profile_reset();
+}
+
+void profile_add(uint8_t slot, uint16_t start)
+{
+    uint16_t dt = profile_now() - start;
+    dt = (dt > prof_overhead) ? (dt - prof_overhead) : 0;
+
+    if (dt < prof_min[slot]) prof_min[slot] = dt;
+    if (dt > prof_max[slot]) prof_max[slot] = dt;
+    prof_sum[slot] += dt;
+    prof_sampled = true;
+}
+
+#ifdef PROFILE_OVERLAY
+
+// Two columns of 20 chars: "TANK ######## 12345"
+// One '#' per 1024 cycles, so a full bar is ~6% of an 8MHz frame.
+#define PROF_ROW_FIRST  3
+#define PROF_ROWS       ((PROF_COUNT + 1) / 2)
+
+static void profile_report(void)
+{
+    char buf[21];
+
+    for (uint8_t i = 0; i < PROF_COUNT; i++) {
+        uint16_t avg = prof_sum[i] / PROFILE_WINDOW;
+        uint8_t bars = (avg >> 10) > 8 ? 8 : (avg >> 10);
+        uint8_t n = 0;
+
+        for (uint8_t c = 0; c < 4; c++) buf[n++] = prof_names[i][c];
+        buf[n++] = ' ';
+        for (uint8_t b = 0; b < 8; b++) buf[n++] = (b < bars) ? '#' : '.';
+        sprintf(&buf[n], " %5u ", avg);
+
+        uint8_t col = (i < PROF_ROWS) ? 0 : 20;
+        uint8_t row = PROF_ROW_FIRST + (i % PROF_ROWS);
+        draw_text(col, row, buf, (avg >> 10) >= 8 ? HUD_COL_RED : HUD_COL_GREEN);
+    }
+}
+
+#else
+
+// One line per subsystem: "TANK 123/456/789" (min/avg/max cycles)
+static void profile_report(void)
+{
+    printf("PROF %u frames\n", PROFILE_WINDOW);
+    for (uint8_t i = 0; i < PROF_COUNT; i++) {
+        printf("%s %u/%u/%u\n", prof_names[i], prof_min[i],
+               (uint16_t)(prof_sum[i] / PROFILE_WINDOW), prof_max[i]);
+    }
+}
+
+#endif // PROFILE_OVERLAY
+
+// Call once per frame. Frames with nothing timed (title, game over) are
+// ignored, so a window always means PROFILE_WINDOW frames of gameplay.
+void profile_end_frame(void)
+{
+    if (!prof_sampled) return;
+    prof_sampled = false;
+
+    if (++prof_frames < PROFILE_WINDOW) return;
+
+    profile_report();
+    profile_reset();
+}
+
+#endif // PROFILE
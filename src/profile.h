@@ -0,0 +1,68 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <stdint.h>
+
+// ============================================================================
+// FRAME PROFILER (optional)
+// ============================================================================
+// Configure with -DPROFILE=ON to time every update_* call in STATE_PLAYING.
+// Each call is bracketed by PROFILE_CALL(); the profiler keeps min/avg/max
+// cycles per subsystem over PROFILE_WINDOW frames and then reports them:
+//   - default:            compact dump over the console UART (printf)
+//   - PROFILE_OVERLAY=ON: bars drawn into the HUD text plane
+//
+// Time comes from VIA timer 1 free-running at PHI2, so the numbers are CPU
+// cycles. Under an emulator with its own cycle counter, define PROFILE_CLOCK
+// as an expression returning a count-up uint16_t and it is used instead.
+//
+// With PROFILE off every macro below compiles to the bare call.
+
+typedef enum {
+    PROF_CHOPPER,
+    PROF_CLOUDS,
+    PROF_LANDING,
+    PROF_HOMEBASE,
+    PROF_FLAGS,
+    PROF_ENEMYBASE,
+    PROF_BALLOON,
+    PROF_BOOM,
+    PROF_BULLET,
+    PROF_EBULLETS,
+    PROF_BOMB,
+    PROF_HOSTAGES,
+    PROF_EXPLOSION,
+    PROF_SMALL_EXPLOSION,
+    PROF_TANKS,
+    PROF_JET,
+    PROF_COLLISIONS,
+    PROF_HUD,
+    PROF_LIVES,
+    PROF_COUNT
+} ProfileSlot;
+
+#define PROFILE_WINDOW 64   // Frames per report (power of two)
+
+#ifdef PROFILE
+
+extern void profile_init(void);
+extern uint16_t profile_now(void);
+extern void profile_add(uint8_t slot, uint16_t start);
+extern void profile_end_frame(void);
+
+#define PROFILE_CALL(slot, call) \
+    do { \
+        uint16_t _pt = profile_now(); \
+        call; \
+        profile_add((slot), _pt); \
+    } while (0)
+
+#else
+
+#define profile_init()              ((void)0)
+#define profile_end_frame()         ((void)0)
+#define PROFILE_CALL(slot, call)    call
+
+#endif // PROFILE
+
+#endif // PROFILE_H
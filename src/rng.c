@@ -0,0 +1,21 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include "rng.h"
+
+static uint16_t rng_state = RNG_DEFAULT_SEED;
+
+void rng_seed(uint16_t seed)
+{
+    // Zero is the one state xorshift never leaves
+    rng_state = seed ? seed : RNG_DEFAULT_SEED;
+}
+
+uint16_t rng_next16(void)
+{
+    uint16_t x = rng_state;
+    x ^= x << 7;
+    x ^= x >> 9;
+    x ^= x << 8;
+    rng_state = x;
+    return x;
+}
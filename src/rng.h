@@ -0,0 +1,42 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ============================================================================
+// GAMEPLAY RANDOM NUMBERS
+// ============================================================================
+// 16-bit xorshift (shifts 7, 9, 8), period 65535. On the 6502 the >> 9 and
+// << 8 are byte moves plus one shift, so a number costs a few dozen cycles
+// instead of libc rand()'s 32-bit multiply and the % that usually follows.
+//
+// The sequence depends only on the seed, so a run with the same seed and
+// the same input replays exactly. main() seeds with RNG_DEFAULT_SEED.
+//
+// Ranges avoid division: rng_chance() compares against a threshold the
+// compiler works out, and rng_below() scales by multiplying and keeping the
+// high byte.
+
+#define RNG_DEFAULT_SEED 0xACE1
+
+extern void rng_seed(uint16_t seed);     // Any value; 0 is swapped for the default
+extern uint16_t rng_next16(void);
+
+#define rng_next8()         ((uint8_t)(rng_next16() >> 8))
+
+// True with probability pct/100 (to the nearest 1/256). The threshold is
+// 16-bit so 100 (or more, up to 255) gives 256 and is always true.
+#define RNG_PCT_THRESHOLD(pct)  ((uint16_t)(((uint16_t)(pct) * 256u + 50u) / 100u))
+#define rng_chance(pct)     (rng_next8() < RNG_PCT_THRESHOLD(pct))
+
+// 50/50
+#define rng_coin()          ((rng_next8() & 0x80) != 0)
+
+// 0 .. n-1 for n up to 256, without a modulo
+#define rng_below(n)        ((uint8_t)(((uint16_t)rng_next8() * (n)) >> 8))
+
+// 0 .. n-1 for n up to 65536
+#define rng_below16(n)      ((uint16_t)(((uint32_t)rng_next16() * (n)) >> 16))
+
+#endif // RNG_H
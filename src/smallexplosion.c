@@ -5,75 +5,64 @@
 #include "constants.h"
 #include "smallexplosion.h"
 #include "player.h"
+#include "sprites.h"
+#include "world.h"
+#include "pool.h"
+#include "luts.h"
 
-typedef struct {
-    bool active;
-    int32_t world_x;
-    int16_t y; // Subpixels
-    uint8_t frame;
-    uint8_t timer;
-} SmallExplosion;
+// One array per field (index = slot); small_exp_pool says which are live
+static Pool     small_exp_pool;
+_Static_assert(MAX_EXPLOSIONS <= POOL_MAX_SLOTS, "raise POOL_MAX_SLOTS");
+static WorldX16 small_exp_x[MAX_EXPLOSIONS];
+static uint16_t small_exp_y[MAX_EXPLOSIONS];   // 8.8
+static AnimCursor small_exp_anim[MAX_EXPLOSIONS];
 
-SmallExplosion small_explosions[MAX_EXPLOSIONS];
-
-// Helper to get offset. 8x8 sprite = 64 pixels * 2 bytes = 128 bytes per frame.
-uint16_t get_small_exp_ptr(uint8_t frame) {
-    return SMALL_EXPLOSION_DATA + (frame * 128); 
+void reset_small_explosions(void) {
+    pool_init(&small_exp_pool, MAX_EXPLOSIONS);
+    sprite_hide_range(SPR_SMALL_EXPLOSION, MAX_EXPLOSIONS);
 }
 
-void spawn_small_explosion(int32_t wx, int16_t wy) {
-    for (int i = 0; i < MAX_EXPLOSIONS; i++) {
-        if (!small_explosions[i].active) {
-            small_explosions[i].active = true;
-            // Center the 8x8 explosion on the impact point
-            // Impact is usually center of bullet. 
-            // Explosion 8x8 -> offset by -4 pixels.
-            small_explosions[i].world_x = wx - (4 << SUBPIXEL_BITS);
-            small_explosions[i].y = wy - (4 << SUBPIXEL_BITS);
-            
-            small_explosions[i].frame = 0;
-            small_explosions[i].timer = 0;
-            break; // Spawned one, stop looking
-        }
-    }
+void spawn_small_explosion(WorldX16 wx, uint16_t wy) {
+    uint8_t i = pool_alloc(&small_exp_pool);
+    if (i == POOL_NONE) return; // All busy, skip this one
+
+    // Center the 8x8 explosion on the impact point
+    // Impact is usually center of bullet. 
+    // Explosion 8x8 -> offset by -4 pixels.
+    small_exp_x[i] = wx - (4 << SUBPIXEL_BITS);
+    small_exp_y[i] = wy - (4 << SUBPIXEL_BITS_Y);
+    
+    anim_restart(&small_exp_anim[i], &ANIM_SMALL_EXPLOSION);
 }
 
 void update_small_explosions(void) {
-    for (int i = 0; i < MAX_EXPLOSIONS; i++) {
-        unsigned cfg_addr = SMALL_EXPLOSION_CONFIG + (i * sizeof(vga_mode4_sprite_t));
+    // Live ones only; free slots were hidden when they finished
+    for (uint8_t k = small_exp_pool.count; k-- > 0; ) {
+        uint8_t i = small_exp_pool.live[k];
+        uint8_t slot = SPR_SMALL_EXPLOSION + i;
 
-        if (!small_explosions[i].active) {
-            // Ensure hidden
-            xram0_struct_set(cfg_addr, vga_mode4_sprite_t, y_pos_px, -8);
+        // --- ANIMATION ---
+        AnimStep step = anim_step(&small_exp_anim[i]);
+
+        // Animation finished?
+        if (step == ANIM_DONE) {
+            pool_free(&small_exp_pool, i);
+            sprite_hide(slot);
             continue;
         }
-
-        // --- ANIMATION ---
-        small_explosions[i].timer++;
-        if (small_explosions[i].timer > SMALL_EXP_DELAY) {
-            small_explosions[i].timer = 0;
-            small_explosions[i].frame++;
-            
-            // Animation finished?
-            if (small_explosions[i].frame >= SMALL_EXP_FRAMES) {
-                small_explosions[i].active = false;
-                xram0_struct_set(cfg_addr, vga_mode4_sprite_t, y_pos_px, -8);
-                continue;
-            }
+        if (step == ANIM_CHANGED) {
+            sprite_set(slot, xram_sprite_ptr, anim_cell(&small_exp_anim[i]));
         }
 
         // --- RENDER ---
-        int32_t screen_sub = small_explosions[i].world_x - camera_x;
-        int16_t screen_px  = screen_sub >> SUBPIXEL_BITS;
+        int16_t screen_px = SCREEN_PX16(small_exp_x[i]);
 
         // Visibility Check (8x8 sprite)
-        if (screen_px > -8 && screen_px < 328) {
-            xram0_struct_set(cfg_addr, vga_mode4_sprite_t, x_pos_px, screen_px);
-            xram0_struct_set(cfg_addr, vga_mode4_sprite_t, y_pos_px, small_explosions[i].y >> SUBPIXEL_BITS);
-            xram0_struct_set(cfg_addr, vga_mode4_sprite_t, xram_sprite_ptr, get_small_exp_ptr(small_explosions[i].frame));
+        if (ON_SCREEN(screen_px, 8)) {
+            sprite_show(slot, screen_px, Y_PX(small_exp_y[i]));
         } else {
             // Visible logic is active, but physically off-screen
-            xram0_struct_set(cfg_addr, vga_mode4_sprite_t, y_pos_px, -8);
+            sprite_hide(slot);
         }
     }
 }
\ No newline at end of file
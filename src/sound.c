@@ -1,5 +1,6 @@
 #include "sound.h"
 #include "constants.h"
+#include "luts.h"
 #include <rp6502.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -78,11 +79,10 @@ void play_sound(uint8_t sfx_type, uint16_t freq, uint8_t wave,
 
     uint16_t psg_addr = PSG_XRAM_ADDR + (channel * 8);
     
-    // Set frequency (Hz * 3)
-    uint16_t freq_val = freq * 3;
+    // Set frequency (already PSG units, see PSG_HZ)
     RIA.addr0 = psg_addr;
-    RIA.rw0 = freq_val & 0xFF;          // freq low byte
-    RIA.rw0 = (freq_val >> 8) & 0xFF;   // freq high byte
+    RIA.rw0 = freq & 0xFF;              // freq low byte
+    RIA.rw0 = (freq >> 8) & 0xFF;       // freq high byte
     
     // Set duty cycle (50%)
     RIA.rw0 = 128;
@@ -108,43 +108,43 @@ void sfx_player_shoot(void) {
     // Fast decay noise/square mix usually works well, but using Noise here
     // Freq 400Hz, Noise, Attack 0 (Instant), Decay 6 (Fast), Release 0, Vol 2
     // play_sound(SFX_TYPE_PLAYER_FIRE, 400, PSG_WAVE_NOISE, 0, 6, 0, 2);
-    play_sound(SFX_TYPE_PLAYER_FIRE, 210, PSG_WAVE_SQUARE, 0, 3, 4, 2);
+    play_sound(SFX_TYPE_PLAYER_FIRE, PSG_HZ(210), PSG_WAVE_SQUARE, 0, 3, 4, 2);
 }
 
 void sfx_enemy_shoot(void) {
     // Lower pitch, slightly longer
     // play_sound(SFX_TYPE_ENEMY_FIRE, 200, PSG_WAVE_SQUARE, 0, 8, 4, 2);
-    play_sound(SFX_TYPE_ENEMY_FIRE, 440, PSG_WAVE_TRIANGLE, 0, 4, 3, 3);
+    play_sound(SFX_TYPE_ENEMY_FIRE, PSG_HZ(440), PSG_WAVE_TRIANGLE, 0, 4, 3, 3);
 }
 void sfx_explosion_small(void) {
     // Quick pop. Low freq noise.
     // Freq 100, Noise, A:0, D:8, R:4, Vol: 2
-    play_sound(SFX_TYPE_EXPLOSION, 100, PSG_WAVE_NOISE, 0, 6, 4, 2);
+    play_sound(SFX_TYPE_EXPLOSION, PSG_HZ(100), PSG_WAVE_NOISE, 0, 6, 4, 2);
 }
 
 void sfx_explosion_large(void) {
     // Deep, long rumble. 
     // Freq 50, Noise, A:0, D:9 (Slow), R:10, Vol: 0 (Max Loud)
-    play_sound(SFX_TYPE_EXPLOSION, 50, PSG_WAVE_NOISE, 0, 9, 10, 0);
+    play_sound(SFX_TYPE_EXPLOSION, PSG_HZ(50), PSG_WAVE_NOISE, 0, 9, 10, 0);
 }
 
 void sfx_bomb_drop(void) {
     // Classic falling bomb whistle — call every frame with decreasing freq
     // Moderate volume, quick decay → clean descending tone
-    play_sound(SFX_TYPE_EVENT, 1200, PSG_WAVE_SAWTOOTH, 0, 5, 4, 3);
+    play_sound(SFX_TYPE_EVENT, PSG_HZ(1200), PSG_WAVE_SAWTOOTH, 0, 5, 4, 3);
     // decay_rate 5 → ~168 ms tail — enough for whistle feel, cuts cleanly
     // volume 3 → solid loudness without harshness
 }
 
 void sfx_hostage_rescue(void) {
     // Happy short ding
-    play_sound(SFX_TYPE_EVENT, 1500, PSG_WAVE_SQUARE, 0, 4, 4, 2);
+    play_sound(SFX_TYPE_EVENT, PSG_HZ(1500), PSG_WAVE_SQUARE, 0, 4, 4, 2);
     // decay 4 → ~114 ms, quick bright blip
 }
 
 void sfx_hostage_die(void) {
     // Low, somber tone — slightly longer tail
-    play_sound(SFX_TYPE_EVENT, 200, PSG_WAVE_SQUARE, 0, 7, 6, 4);
+    play_sound(SFX_TYPE_EVENT, PSG_HZ(200), PSG_WAVE_SQUARE, 0, 7, 6, 4);
     // decay 7 → ~240 ms fade, gives a mournful feel without dragging
 }
 
@@ -186,7 +186,7 @@ void update_chopper_sound(uint16_t velocity_mag) {
     // --- WRITE TO HARDWARE ---
     
     // Set Frequency
-    uint16_t freq_val = freq * 3; // PSG scaling
+    uint16_t freq_val = PSG_HZ(freq);
     RIA.addr0 = psg_addr;
     RIA.rw0 = freq_val & 0xFF;
     RIA.rw0 = (freq_val >> 8) & 0xFF;
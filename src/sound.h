@@ -35,7 +35,7 @@ extern void init_psg(void);
 /**
  * Play a sound effect with round-robin channel allocation
  * @param sfx_type Sound effect type (determines channel allocation)
- * @param freq Frequency in Hz
+ * @param freq Frequency in PSG units (PSG_HZ(hz) from luts.h)
  * @param wave Waveform type
  * @param attack Attack rate (0-15)
  * @param decay Decay rate (0-15)
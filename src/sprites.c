@@ -0,0 +1,154 @@
+#include <rp6502.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "constants.h"
+#include "sprites.h"
+
+// RAM copy of every sprite config record, indexed by logical slot
+vga_mode4_sprite_t sprite_shadow[SPRITE_COUNT];
+uint8_t sprite_dirty[SPRITE_COUNT];
+uint8_t sprite_visible[SPRITE_COUNT];
+
+// Logical slot <-> physical XRAM record. Only visible sprites own a
+// physical record; each plane keeps its live records packed at the front
+// of its region, sorted by logical slot so draw order never changes.
+static uint8_t sprite_phys[SPRITE_COUNT];
+static uint8_t sprite_logical[SPRITE_COUNT];
+
+typedef struct {
+    uint8_t first;      // First physical record of this plane's region
+    uint8_t live;       // Records currently enabled
+    uint8_t plane;      // VGA plane passed to xregn
+    bool changed;       // Live count changed since the last flush
+} SpritePlane;
+
+static SpritePlane sprite_planes[2] = {
+    { 0,            0, 2, true },   // Foreground
+    { SPR_FG_COUNT, 0, 1, true },   // Background
+};
+
+// The XRAM plane configs are prebuilt from the same record count
+_Static_assert(SPRITE_CONFIG_RECORDS == SPRITE_COUNT,
+               "SPRITE_CONFIG_RECORDS in constants.h is out of date");
+
+static SpritePlane *plane_of(uint8_t slot)
+{
+    return (slot < SPR_FG_END) ? &sprite_planes[0] : &sprite_planes[1];
+}
+
+// Claim the next record for a slot, shifting any higher slots up by one
+static void sprite_alloc(uint8_t slot)
+{
+    SpritePlane *pl = plane_of(slot);
+    uint8_t p = pl->first + pl->live;
+
+    while (p > pl->first && sprite_logical[p - 1] > slot) {
+        uint8_t moved = sprite_logical[p - 1];
+        sprite_logical[p] = moved;
+        sprite_phys[moved] = p;
+        sprite_dirty[moved] = 1;
+        p--;
+    }
+
+    sprite_logical[p] = slot;
+    sprite_phys[slot] = p;
+    sprite_dirty[slot] = 1;
+    pl->live++;
+    pl->changed = true;
+}
+
+// Give a record back and close the gap so the live range stays contiguous
+static void sprite_free(uint8_t slot)
+{
+    SpritePlane *pl = plane_of(slot);
+    uint8_t last = pl->first + pl->live - 1;
+
+    for (uint8_t p = sprite_phys[slot]; p < last; p++) {
+        uint8_t moved = sprite_logical[p + 1];
+        sprite_logical[p] = moved;
+        sprite_phys[moved] = p;
+        sprite_dirty[moved] = 1;
+    }
+
+    pl->live--;
+    pl->changed = true;
+}
+
+// Set up a hidden record in RAM only. It gets written to XRAM the first time
+// it is shown, so nothing is written for it at boot.
+void init_sprite(uint8_t slot, uint16_t data_ptr, uint8_t log_size)
+{
+    sprite_shadow[slot].x_pos_px = SPRITE_HIDDEN_Y;
+    sprite_shadow[slot].y_pos_px = SPRITE_HIDDEN_Y;
+    sprite_shadow[slot].xram_sprite_ptr = data_ptr;
+    sprite_shadow[slot].log_size = log_size;
+    sprite_shadow[slot].has_opacity_metadata = false;
+    sprite_dirty[slot] = 1;
+    sprite_visible[slot] = 0;
+}
+
+// Place a sprite on screen, claiming a record if it was hidden
+void sprite_show(uint8_t slot, int16_t x, int16_t y)
+{
+    sprite_set(slot, x_pos_px, x);
+    sprite_set(slot, y_pos_px, y);
+
+    if (!sprite_visible[slot]) {
+        sprite_visible[slot] = 1;
+        sprite_alloc(slot);
+    }
+}
+
+// Drop a sprite from its plane. Only the visible -> hidden edge does any work.
+void sprite_hide(uint8_t slot)
+{
+    if (!sprite_visible[slot]) return;
+    sprite_visible[slot] = 0;
+    sprite_free(slot);
+}
+
+void sprite_hide_range(uint8_t first, uint8_t count)
+{
+    for (uint8_t i = 0; i < count; i++) {
+        sprite_hide(first + i);
+    }
+}
+
+void flush_sprites(void)
+{
+    RIA.step0 = 1;
+
+    for (uint8_t n = 0; n < 2; n++) {
+        SpritePlane *pl = &sprite_planes[n];
+        uint8_t end = pl->first + pl->live;
+
+        // addr0 auto-increments, so consecutive dirty records stream back to
+        // back. We only re-seek when a clean record breaks the run.
+        bool streaming = false;
+
+        for (uint8_t p = pl->first; p < end; p++) {
+            uint8_t slot = sprite_logical[p];
+            if (!sprite_dirty[slot]) {
+                streaming = false;
+                continue;
+            }
+            sprite_dirty[slot] = 0;
+
+            if (!streaming) {
+                RIA.addr0 = SPRITE_CONFIG_ADDR(p);
+                streaming = true;
+            }
+
+            const uint8_t *src = (const uint8_t *)&sprite_shadow[slot];
+            for (uint8_t b = 0; b < sizeof(vga_mode4_sprite_t); b++) {
+                RIA.rw0 = src[b];
+            }
+        }
+
+        // Only walk as many records as are live
+        if (pl->changed) {
+            pl->changed = false;
+            xregn(1, 0, 1, 5, 4, 0, SPRITE_CONFIG_ADDR(pl->first), pl->live, pl->plane);
+        }
+    }
+}
@@ -0,0 +1,101 @@
+#ifndef SPRITES_H
+#define SPRITES_H
+
+#include <rp6502.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "constants.h"
+#include "player.h"
+#include "hostages.h"
+#include "bullets.h"
+#include "smallexplosion.h"
+#include "tanks.h"
+#include "ebullets.h"
+#include "clouds.h"
+#include "landing.h"
+#include "homebase.h"
+#include "enemybase.h"
+#include "flags.h"
+
+// ============================================================================
+// SPRITE SHADOW TABLE
+// ============================================================================
+// Every vga_mode4_sprite_t record lives in RAM first. Modules write to the
+// shadow copy, which marks the record dirty only when a value really changes.
+// flush_sprites() runs once per frame after the simulation and streams just
+// the dirty records to XRAM with RIA.step0 = 1 (one seek per run of records).
+//
+// Visibility is edge-triggered: sprite_hide() releases a sprite once when it
+// goes hidden and is free on every later call until sprite_show() brings it
+// back. Empty pools therefore cost one byte test per slot and no XRAM writes.
+//
+// The SPR_* values below are logical slots, not XRAM positions. A sprite only
+// owns a physical config record while it is visible. Each plane keeps its
+// live records packed at the front of its region (in logical order, so the
+// draw order is stable) and xregn is re-issued with the live count whenever
+// it changes, so the VGA side never walks parked sprites.
+
+// --- Foreground sprites (Plane 2) ---
+#define SPR_CHOPPER_LEFT      0
+#define SPR_CHOPPER_RIGHT     1
+#define SPR_HOSTAGE           2
+#define SPR_BULLET            (SPR_HOSTAGE + NUM_HOSTAGES)
+#define SPR_EXPLOSION_LEFT    (SPR_BULLET + NUM_BULLETS)
+#define SPR_EXPLOSION_RIGHT   (SPR_EXPLOSION_LEFT + 1)
+#define SPR_SMALL_EXPLOSION   (SPR_EXPLOSION_RIGHT + 1)
+#define SPR_TANK              (SPR_SMALL_EXPLOSION + MAX_EXPLOSIONS)
+#define SPR_EBULLET           (SPR_TANK + (NUM_TANKS * SPRITES_PER_TANK))
+#define SPR_BOOM              (SPR_EBULLET + NEBULLET)
+#define SPR_BALLOON_BOTTOM    (SPR_BOOM + 1)
+#define SPR_BALLOON_TOP       (SPR_BALLOON_BOTTOM + 1)
+#define SPR_JET_LEFT          (SPR_BALLOON_TOP + 1)
+#define SPR_JET_RIGHT         (SPR_JET_LEFT + 1)
+#define SPR_BOMB              (SPR_JET_RIGHT + 1)
+#define SPR_JET_BULLET        (SPR_BOMB + 1)
+#define SPR_JET_BOMB          (SPR_JET_BULLET + 1)
+#define SPR_MINICHOPPER       (SPR_JET_BOMB + 1)
+#define SPR_FG_END            (SPR_MINICHOPPER + LIVES_STARTING)
+
+// --- Background sprites (Plane 1) ---
+#define SPR_CLOUD             SPR_FG_END
+#define SPR_LANDINGPAD        (SPR_CLOUD + NUM_CLOUDS)
+#define SPR_HOMEBASE          (SPR_LANDINGPAD + NUM_LANDING_PAD_SPRITE)
+#define SPR_ENEMYBASE         (SPR_HOMEBASE + NUM_HOMEBASE_SPRITE)
+#define SPR_FLAGS             (SPR_ENEMYBASE + NUM_ENEMYBASE_SPRITE)
+#define SPR_BG_END            (SPR_FLAGS + NUM_FLAGS)
+
+#define SPRITE_COUNT          SPR_BG_END
+#define SPR_FG_COUNT          SPR_FG_END
+#define SPR_BG_COUNT          (SPR_BG_END - SPR_FG_END)
+
+// Sprite config records sit right after the sprite pixel data in XRAM
+// (SPRITE_CONFIG_BASE comes from xram_layout.h). The foreground region
+// holds SPR_FG_COUNT records, then the background.
+#define SPRITE_CONFIG_ADDR(rec) (SPRITE_CONFIG_BASE + ((rec) * sizeof(vga_mode4_sprite_t)))
+#define SPRITE_CONFIG_END     SPRITE_CONFIG_ADDR(SPRITE_COUNT)
+
+// Position given to sprites that have never been shown
+#define SPRITE_HIDDEN_Y       -32
+
+extern vga_mode4_sprite_t sprite_shadow[];
+extern uint8_t sprite_dirty[];
+extern uint8_t sprite_visible[];
+
+// Shadow equivalent of xram0_struct_set(). Only touches the record (and
+// marks it for the next flush) when the value is different.
+#define sprite_set(slot, member, val) \
+    do { \
+        __typeof__(sprite_shadow[0].member) _v = (val); \
+        if (sprite_shadow[(slot)].member != _v) { \
+            sprite_shadow[(slot)].member = _v; \
+            sprite_dirty[(slot)] = 1; \
+        } \
+    } while (0)
+
+extern void init_sprite(uint8_t slot, uint16_t data_ptr, uint8_t log_size);
+extern void sprite_show(uint8_t slot, int16_t x, int16_t y);
+extern void sprite_hide(uint8_t slot);
+extern void sprite_hide_range(uint8_t first, uint8_t count);
+extern void flush_sprites(void);
+
+#endif // SPRITES_H
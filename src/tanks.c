@@ -8,6 +8,10 @@
 #include "player.h"
 #include "enemybase.h"
 #include "hostages.h"
+#include "sprites.h"
+#include "collision.h"
+#include "world.h"
+#include "luts.h"
 
 // Demo mode
 extern bool is_demo_mode;
@@ -15,7 +19,17 @@ extern bool is_demo_mode;
 // --- TANK STATE ---
 bool tanks_triggered = false; // Have we collected 4 hostages yet?
 
-Tank tanks[NUM_TANKS];
+Pool     tank_pool;
+_Static_assert(NUM_TANKS <= POOL_MAX_SLOTS, "raise POOL_MAX_SLOTS");
+WorldX16 tank_x[NUM_TANKS];
+uint16_t tank_y[NUM_TANKS];
+int8_t   tank_dir[NUM_TANKS];
+AnimCursor tank_anim[NUM_TANKS];
+uint8_t  tank_turret[NUM_TANKS];
+uint8_t  tank_health[NUM_TANKS];
+uint8_t  tank_base[NUM_TANKS];
+uint8_t  tank_cooldown[NUM_TANKS];
+MetaSprite tank_meta[NUM_TANKS];
 
 // Initial Spawn Locations (Example)
 const int32_t TANK_SPAWNS[NUM_TANKS] = {
@@ -26,27 +40,15 @@ const int32_t TANK_SPAWNS[NUM_TANKS] = {
 // Spawn Timer
 static int tank_spawn_timer = 0;
 
-int get_closest_base_index(void) {
-    int closest_i = -1;
-    int32_t min_dist = 0x7FFFFFFF;
-
-    for (int i = 0; i < NUM_ENEMY_BASES; i++) {
-        // REMOVED: if (base_state[i].destroyed) continue; 
-        
-        int32_t base_x = ENEMY_BASE_LOCATIONS[i];
-        int32_t dist = labs(chopper_world_x - base_x);
-        
-        if (dist < min_dist) {
-            min_dist = dist;
-            closest_i = i;
+// Give each tank slot its run of sprites (8x8, pointed at a frame on draw)
+void init_tank_sprites(void) {
+    for (uint8_t t = 0; t < NUM_TANKS; t++) {
+        uint8_t first = SPR_TANK + (t * SPRITES_PER_TANK);
+        for (uint8_t i = 0; i < SPRITES_PER_TANK; i++) {
+            init_sprite(first + i, TANK_DATA, 3);
         }
+        metasprite_init(&tank_meta[t], first);
     }
-    return closest_i;
-}
-
-// Helper to get pointer to specific 16x16 tile index
-uint16_t get_tank_tile_ptr(int index) {
-    return TANK_DATA + (index * 128);
 }
 
 void reset_tanks(void) {
@@ -55,14 +57,9 @@ void reset_tanks(void) {
     tank_spawn_timer = 0;
 
     // 2. Clear Active Tanks & Sprites
-    for (int t = 0; t < NUM_TANKS; t++) {
-        tanks[t].active = false;
-        
-        // Hide all 9 sprites for this tank
-        for (int s = 0; s < 9; s++) {
-            unsigned cfg = TANK_CONFIG + ((t * 9 + s) * sizeof(vga_mode4_sprite_t));
-            xram0_struct_set(cfg, vga_mode4_sprite_t, y_pos_px, -32);
-        }
+    pool_init(&tank_pool, NUM_TANKS);
+    for (uint8_t t = 0; t < NUM_TANKS; t++) {
+        metasprite_hide(&tank_meta[t]);
     }
 }
 
@@ -79,9 +76,7 @@ void update_tanks(void) {
     //     int active_count = 0;
         
     //     // Count how many tanks are actually driving around right now
-    //     for(int t=0; t<NUM_TANKS; t++) {
-    //         if (tanks[t].active) active_count++;
-    //     }
+    //     active_count = tank_pool.count;
 
     //     if (b != -1) {
     //         printf("DEBUG - Base %d | Garage: %d | Cooldown: %d | Active Tanks: %d | Triggered: %d\n", 
@@ -123,33 +118,26 @@ void update_tanks(void) {
     // =========================================================
     if (tank_spawn_timer > 0) tank_spawn_timer--;
 
-    int b = get_closest_base_index();
+    uint8_t b = world.closest_base;
 
     // Only try to spawn if Triggered, Cooldown Ready, and Tanks Available
-    if (tanks_triggered && b != -1 && 
+    if (tanks_triggered && 
         base_state[b].tanks_remaining > 0 && 
         base_state[b].tank_cooldown == 0 && 
         tank_spawn_timer == 0) {
         
-        // Find hardware slot
-        int free_slot = -1;
-        for (int t = 0; t < NUM_TANKS; t++) {
-            if (!tanks[t].active) {
-                free_slot = t;
-                break;
-            }
-        }
-
-        if (free_slot != -1) {
+        // Any hardware slot free?
+        if (tank_pool.count < NUM_TANKS) {
             int32_t base_x = ENEMY_BASE_LOCATIONS[b];
             
             // Check currently active tanks for THIS base to find the empty side
             bool has_left_tank = false;
             bool has_right_tank = false;
 
-            for (int t = 0; t < NUM_TANKS; t++) {
-                if (tanks[t].active && tanks[t].base_id == b) {
-                    if (tanks[t].world_x < base_x) has_left_tank = true;
+            for (uint8_t k = 0; k < tank_pool.count; k++) {
+                uint8_t t = tank_pool.live[k];
+                if (tank_base[t] == b) {
+                    if (WORLD_DX16(tank_x[t], base_x) < 0) has_left_tank = true;
                     else has_right_tank = true;
                 }
             }
@@ -188,20 +176,24 @@ void update_tanks(void) {
 
             // FINAL EXECUTION
             if (can_spawn) {
-                // Clamp World Limits
+                // Clamp World Limits (the whole tank stays inside, so the
+                // 16-bit position below never wraps)
                 if (spawn_x < WORLD_MIN_X_SUB) spawn_x = WORLD_MIN_X_SUB;
-                if (spawn_x > WORLD_MAX_X_SUB) spawn_x = WORLD_MAX_X_SUB;
-
-                tanks[free_slot].active = true;
-                tanks[free_slot].base_id = b;
-                tanks[free_slot].world_x = spawn_x;
-                tanks[free_slot].y = GROUND_Y_SUB + (32 << SUBPIXEL_BITS); // Your Y coord
-                tanks[free_slot].direction = start_dir;
-                tanks[free_slot].health = 1;
+                if (spawn_x > WORLD_MAX_X_SUB - ((int32_t)TANK_WIDTH_PX << SUBPIXEL_BITS)) {
+                    spawn_x = WORLD_MAX_X_SUB - ((int32_t)TANK_WIDTH_PX << SUBPIXEL_BITS);
+                }
+
+                uint8_t free_slot = pool_alloc(&tank_pool);
+                tank_base[free_slot] = b;
+                tank_x[free_slot] = WORLD_X16(spawn_x);
+                tank_y[free_slot] = GROUND_Y_SUB + (32 << SUBPIXEL_BITS_Y); // Your Y coord
+                tank_dir[free_slot] = start_dir;
+                tank_health[free_slot] = 1;
+                anim_restart(&tank_anim[free_slot], &ANIM_TANK_TREADS);
                 
                 base_state[b].tanks_remaining--;
                 tank_spawn_timer = 60; // Wait 1 second before trying next spawn
-                tanks[free_slot].fire_cooldown = 20; // 60 + (rand() % 60);
+                tank_cooldown[free_slot] = 20; // 60 + (rand() % 60);
             }
         }
     }
@@ -209,31 +201,26 @@ void update_tanks(void) {
     // =========================================================
     // 3. AI & MOVEMENT LOOP
     // =========================================================
-    for (int t = 0; t < NUM_TANKS; t++) {
-        // --- CLEANUP ---
-        if (!tanks[t].active) {
-            // Hide sprites
-            for(int s=0; s<9; s++) {
-                unsigned cfg = TANK_CONFIG + ((t*9 + s) * sizeof(vga_mode4_sprite_t));
-                xram0_struct_set(cfg, vga_mode4_sprite_t, y_pos_px, -32);
-            }
-            continue;
-        }
+    for (uint8_t k = tank_pool.count; k-- > 0; ) {
+        uint8_t t = tank_pool.live[k];
 
         // --- DESPAWN LOGIC ---
         // If tank is from a different base (we moved away), remove it.
-        if (tanks[t].base_id != get_closest_base_index()) {
-            tanks[t].active = false;
-            base_state[tanks[t].base_id].tanks_remaining++; // Return to garage
+        if (tank_base[t] != world.closest_base) {
+            pool_free(&tank_pool, t);
+            metasprite_hide(&tank_meta[t]);
+            base_state[tank_base[t]].tanks_remaining++; // Return to garage
             continue;
         }
 
         // --- AI LOGIC ---
-        int32_t base_x = ENEMY_BASE_LOCATIONS[tanks[t].base_id];
-        int32_t dist_from_base = tanks[t].world_x - base_x;
-        int32_t chop_cx = chopper_world_x + (16 << SUBPIXEL_BITS);
-        int32_t tank_cx = tanks[t].world_x + (20 << SUBPIXEL_BITS); 
-        int32_t dist_to_chopper = chop_cx - tank_cx;
+        // All 16-bit: the tank, its base and the chopper are never more
+        // than a screen or so apart (see WORLD_DX16)
+        WorldX16 base_x = WORLD_X16(ENEMY_BASE_LOCATIONS[tank_base[t]]);
+        int16_t dist_from_base = WORLD_DX16(tank_x[t], base_x);
+        WorldX16 chop_cx = world.chopper_x16 + (16 << SUBPIXEL_BITS);
+        WorldX16 tank_cx = tank_x[t] + (20 << SUBPIXEL_BITS); 
+        int16_t dist_to_chopper = WORLD_DX16(chop_cx, tank_cx);
 
         // 1. Basic Desire
         int8_t target_dir = (dist_to_chopper > 0) ? 1 : -1;
@@ -243,75 +230,48 @@ void update_tanks(void) {
         else if (dist_from_base < -TANK_LEASH_DIST) target_dir = 1;
 
         // 3. Stop if under chopper
-        if (labs(dist_to_chopper) < (4 << SUBPIXEL_BITS)) target_dir = 0;
+        if (abs(dist_to_chopper) < (4 << SUBPIXEL_BITS)) target_dir = 0;
 
         // 4. Staggering (Prevent Overlap)
         if (target_dir != 0) {
-            for (int other = 0; other < NUM_TANKS; other++) {
-                if (t == other || !tanks[other].active) continue;
-                int32_t sep = tanks[other].world_x - tanks[t].world_x;
+            for (uint8_t j = 0; j < tank_pool.count; j++) {
+                uint8_t other = tank_pool.live[j];
+                if (t == other) continue;
+                int16_t sep = WORLD_DX16(tank_x[other], tank_x[t]);
                 if (target_dir == 1 && sep > 0 && sep < TANK_SPACING) target_dir = 0;
                 if (target_dir == -1 && sep < 0 && sep > -TANK_SPACING) target_dir = 0;
             }
         }
 
         // --- PHYSICS & ANIMATION ---
-        tanks[t].direction = target_dir;
-        if (target_dir == 1)  tanks[t].world_x += TANK_SPEED;
-        if (target_dir == -1) tanks[t].world_x -= TANK_SPEED;
+        tank_dir[t] = target_dir;
+        if (target_dir == 1)  tank_x[t] += TANK_SPEED;
+        if (target_dir == -1) tank_x[t] -= TANK_SPEED;
 
         if (target_dir != 0) {
-            tanks[t].anim_timer++;
-            if (tanks[t].anim_timer > 8) {
-                tanks[t].anim_timer = 0;
-                tanks[t].anim_frame = !tanks[t].anim_frame;
-            }
+            anim_step(&tank_anim[t]);
         }
 
         // --- TURRET AIMING ---
         int16_t diff_x_px = dist_to_chopper >> SUBPIXEL_BITS;
-        if (diff_x_px > 20)      tanks[t].turret_dir = TURRET_RIGHT;
-        else if (diff_x_px < -20) tanks[t].turret_dir = TURRET_UP_LEFT;
-        else                      tanks[t].turret_dir = TURRET_UP;
+        if (diff_x_px > 20)      tank_turret[t] = TURRET_RIGHT;
+        else if (diff_x_px < -20) tank_turret[t] = TURRET_UP_LEFT;
+        else                      tank_turret[t] = TURRET_UP;
 
-        // --- RENDER ---
-        int32_t screen_sub = tanks[t].world_x - camera_x;
-        int16_t screen_px = screen_sub >> SUBPIXEL_BITS;
-
-        if (screen_px > -100 && screen_px < 340) {
-            // (Your existing Body/Turret render code goes here)
-            // ...
-            // Re-use the render block from previous steps
-            // ...
-            int body_start = (tanks[t].anim_frame == 0) ? 0 : 5;
-            int16_t base_y_px = tanks[t].y >> SUBPIXEL_BITS;
-
-            for (int i = 0; i < 5; i++) {
-                unsigned cfg = TANK_CONFIG + ((t*9 + i) * sizeof(vga_mode4_sprite_t));
-                xram0_struct_set(cfg, vga_mode4_sprite_t, x_pos_px, (screen_px + (i * 8)));
-                xram0_struct_set(cfg, vga_mode4_sprite_t, y_pos_px, base_y_px);
-                xram0_struct_set(cfg, vga_mode4_sprite_t, xram_sprite_ptr, get_tank_tile_ptr(body_start + i));
-            }
+        // --- HITBOX (bombs) ---
+        collision_add(COL_TANK, t, tank_x[t], tank_y[t]);
 
-            int turret_start;
-            switch(tanks[t].turret_dir) {
-                case TURRET_UP_LEFT: turret_start = 10; break;
-                case TURRET_UP:      turret_start = 14; break;
-                default:             turret_start = 18; break; 
-            }
+        // --- RENDER ---
+        int16_t screen_px = SCREEN_PX16(tank_x[t]);
 
-            for (int i = 0; i < 4; i++) {
-                unsigned cfg = TANK_CONFIG + ((t*9 + (5+i)) * sizeof(vga_mode4_sprite_t));
-                xram0_struct_set(cfg, vga_mode4_sprite_t, x_pos_px, (screen_px + 4 + (i * 8)));
-                xram0_struct_set(cfg, vga_mode4_sprite_t, y_pos_px, (base_y_px - 8));
-                xram0_struct_set(cfg, vga_mode4_sprite_t, xram_sprite_ptr, get_tank_tile_ptr(turret_start + i));
-            }
+        if (ON_SCREEN(screen_px, TANK_WIDTH_PX)) {
+            // Tread frame and turret pick one composite frame; the
+            // metasprite only touches the sprites if something changed
+            uint8_t f = anim_cell(&tank_anim[t]) + tank_turret[t];
+            metasprite_draw(&tank_meta[t], &TANK_META[f], screen_px, Y_PX(tank_y[t]));
         } else {
             // Offscreen hide
-            for(int s=0; s<9; s++) {
-                unsigned cfg = TANK_CONFIG + ((t*9 + s) * sizeof(vga_mode4_sprite_t));
-                xram0_struct_set(cfg, vga_mode4_sprite_t, y_pos_px, -32);
-            }
+            metasprite_hide(&tank_meta[t]);
         }
     }
 }
\ No newline at end of file
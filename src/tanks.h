@@ -1,9 +1,14 @@
 #ifndef TANKS_H
 #define TANKS_H
 
+#include "world.h"
+#include "pool.h"
+#include "metasprite.h"
+#include "luts.h"
+
 #define NUM_TANKS 2
-#define SPRITES_PER_TANK 9 
-// Body (5) + Turret (4) = 9
+#define SPRITES_PER_TANK TANK_META_MAX_PARTS
+// Body (5) + Turret (4) = 9, drawn as one metasprite (TANK_META in luts.h)
 
 // --- TANK STATE ---
 #define TANK_WIDTH_PX       40  // 5 * 8px
@@ -30,24 +35,23 @@ typedef enum {
     TURRET_RIGHT   = 2
 } TurretDir;
 
-typedef struct {
-    bool active;
-    int32_t world_x;
-    int16_t y;
-    int8_t direction;       // 1 = Right, -1 = Left
-    uint8_t anim_frame;     
-    uint8_t anim_timer;
-    TurretDir turret_dir;   
-    int health;
-    uint8_t base_id;        // NEW: Which base does this tank belong to?
-    uint8_t fire_cooldown; // Frames until next shot
-} Tank;
-
-extern Tank tanks[];
+// Tank pool, one array per field (index = slot), like the hostages.
+// tank_pool tracks which slots are driving around.
+extern Pool     tank_pool;
+extern WorldX16 tank_x[];           // See world.h
+extern uint16_t tank_y[];           // 8.8
+extern int8_t   tank_dir[];         // 1 = Right, -1 = Left
+extern AnimCursor tank_anim[];       // Treads, cell = TANK_META frame base
+extern uint8_t  tank_turret[];      // TurretDir
+extern uint8_t  tank_health[];
+extern uint8_t  tank_base[];        // Which base does this tank belong to?
+extern uint8_t  tank_cooldown[];    // Frames until next shot
+extern MetaSprite tank_meta[];      // Sprites, SPRITES_PER_TANK each
 extern const int32_t TANK_SPAWNS[];
 extern bool tanks_triggered;
 
 extern void update_tanks(void);
+extern void init_tank_sprites(void);
 extern void reset_tanks(void);
 
 #endif // TANKS_H
\ No newline at end of file
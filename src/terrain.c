@@ -0,0 +1,69 @@
+#include <rp6502.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "constants.h"
+#include "player.h"
+#include "terrain.h"
+#include "luts.h"
+
+// Columns one screen can touch (20 whole ones plus one split at the edges)
+#define TERRAIN_VIEW_COLUMNS ((SCREEN_WIDTH / 16) + 1)
+
+// Nothing loaded yet; far enough from any real column to force a refill
+#define TERRAIN_NOT_LOADED  -1000
+
+_Static_assert(TERRAIN_RING_COLUMNS >= TERRAIN_VIEW_COLUMNS,
+               "The ground ring must hold a whole screen of columns");
+
+// First column the ring holds for the current view
+static int16_t terrain_first = TERRAIN_NOT_LOADED;
+
+// Write terrain column c into its ring slot
+static void load_column(int16_t c)
+{
+    uint8_t tile = (c >= 0 && c < TERRAIN_COLUMNS) ? TERRAIN_TILES[c] : 0;
+
+    RIA.addr0 = GROUND_MAP_START + (TERRAIN_ROW * TERRAIN_RING_COLUMNS)
+              + (c & (TERRAIN_RING_COLUMNS - 1));
+    RIA.rw0 = tile;
+}
+
+void init_terrain(void)
+{
+    terrain_first = TERRAIN_NOT_LOADED;
+    update_terrain();
+}
+
+void update_terrain(void)
+{
+    // Plane position in pixels (parallax: half the camera's speed)
+    int16_t plane_px = (int16_t)(camera_x >> (SUBPIXEL_BITS + TERRAIN_PARALLAX_SHIFT));
+    int16_t first = plane_px >> 4;
+    int16_t moved = first - terrain_first;
+
+    if (moved != 0) {
+        int16_t from, to;   // Columns to load, inclusive
+
+        if (moved >= TERRAIN_VIEW_COLUMNS || moved <= -TERRAIN_VIEW_COLUMNS) {
+            // Jumped: reload the whole view
+            from = first;
+            to = first + TERRAIN_VIEW_COLUMNS - 1;
+        } else if (moved > 0) {
+            // Scrolled right: new columns on the right edge
+            from = terrain_first + TERRAIN_VIEW_COLUMNS;
+            to = first + TERRAIN_VIEW_COLUMNS - 1;
+        } else {
+            // Scrolled left: new columns on the left edge
+            from = first;
+            to = terrain_first - 1;
+        }
+
+        for (int16_t c = from; c <= to; c++) {
+            load_column(c);
+        }
+        terrain_first = first;
+    }
+
+    // The ring wraps, so any multiple of its width lines up the same
+    xram0_struct_set(GROUND_CONFIG, vga_mode2_config_t, x_pos_px, -plane_px);
+}
@@ -0,0 +1,21 @@
+#ifndef TERRAIN_H
+#define TERRAIN_H
+
+// ============================================================================
+// GROUND PLANE TERRAIN
+// ============================================================================
+// The ground plane is a 32-column tile ring in XRAM (GROUND_MAP_START) that
+// wraps horizontally and scrolls at half the camera's speed. Only its
+// mountain row (TERRAIN_ROW) changes along the world; that row comes from
+// TERRAIN_TILES (tools/luts.py), one byte per column. As the plane scrolls
+// a column boundary, the columns coming into view are written into their
+// ring slot, so a normal frame costs one XRAM byte or none.
+
+// Fill the ring for wherever the camera is now
+extern void init_terrain(void);
+
+// Scroll the plane to camera_x and stream in new columns. Copes with the
+// camera jumping (respawn), it just refills the visible columns.
+extern void update_terrain(void);
+
+#endif // TERRAIN_H
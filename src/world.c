@@ -0,0 +1,112 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include "constants.h"
+#include "player.h"
+#include "enemybase.h"
+#include "landing.h"
+#include "homebase.h"
+#include "world.h"
+
+#define ENEMYBASE_WIDTH_PX 64   // Two 32x32 sprites side by side
+#define LANDING_PAD_WIDTH_PX (NUM_LANDING_PAD_SPRITE * 16)
+#define HOMEBASE_WIDTH_PX  48   // Three 16px columns (the flag sits on the middle one)
+
+WorldView world;
+
+Structure world_structures[WORLD_MAX_STRUCTURES];
+uint8_t world_structure_count = 0;
+
+// ENEMY_BASE_LOCATIONS in pixels, so the per-frame work stays 16-bit
+static int16_t base_px[NUM_ENEMY_BASES];
+
+// Window into world_structures[]: [view_lo, view_hi) are the ones that
+// start close enough to the screen to reach it
+static uint8_t view_lo = 0;
+static uint8_t view_hi = 0;
+static uint8_t widest_px = 0;
+
+// Insert keeping the list sorted by left edge
+static void add_structure(int16_t x_px, uint8_t width_px, uint8_t kind, uint8_t index)
+{
+    uint8_t k = world_structure_count++;
+
+    while (k > 0 && world_structures[k - 1].x_px > x_px) {
+        world_structures[k] = world_structures[k - 1];
+        k--;
+    }
+    world_structures[k].x_px = x_px;
+    world_structures[k].width_px = width_px;
+    world_structures[k].kind = kind;
+    world_structures[k].index = index;
+
+    if (width_px > widest_px) widest_px = width_px;
+}
+
+_Static_assert(NUM_ENEMY_BASES + 2 <= WORLD_MAX_STRUCTURES, "raise WORLD_MAX_STRUCTURES");
+
+void init_world_view(void)
+{
+    world_structure_count = 0;
+    widest_px = 0;
+
+    for (uint8_t i = 0; i < NUM_ENEMY_BASES; i++) {
+        base_px[i] = (int16_t)(ENEMY_BASE_LOCATIONS[i] >> SUBPIXEL_BITS);
+        add_structure(base_px[i], ENEMYBASE_WIDTH_PX, STRUCT_ENEMY_BASE, i);
+    }
+    add_structure((int16_t)(LANDING_PAD_WORLD_X >> SUBPIXEL_BITS), LANDING_PAD_WIDTH_PX,
+                  STRUCT_LANDING_PAD, 0);
+    add_structure((int16_t)(HOMEBASE_WORLD_X >> SUBPIXEL_BITS), HOMEBASE_WIDTH_PX,
+                  STRUCT_HOMEBASE, 0);
+
+    view_lo = 0;
+    view_hi = 0;
+    update_world_view();
+}
+
+// Slide the window with the camera and list what overlaps the screen
+static void update_structures_in_view(void)
+{
+    // Starting at or before `reach` means too far left to touch the screen
+    int16_t reach = world.camera_px - widest_px;
+    int16_t right = world.camera_px + SCREEN_WIDTH;
+    uint8_t n = world_structure_count;
+
+    while (view_lo < n && world_structures[view_lo].x_px <= reach) view_lo++;
+    while (view_lo > 0 && world_structures[view_lo - 1].x_px > reach) view_lo--;
+    while (view_hi < n && world_structures[view_hi].x_px < right) view_hi++;
+    while (view_hi > 0 && world_structures[view_hi - 1].x_px >= right) view_hi--;
+
+    // Same test as ON_SCREEN() on the left edge, per structure width
+    world.in_view_count = 0;
+    for (uint8_t k = view_lo; k < view_hi; k++) {
+        const Structure *s = &world_structures[k];
+        if (s->x_px + s->width_px > world.camera_px &&
+            world.in_view_count < WORLD_MAX_IN_VIEW) {
+            world.in_view[world.in_view_count++] = k;
+        }
+    }
+}
+
+void update_world_view(void)
+{
+    world.camera_px = (int16_t)(camera_x >> SUBPIXEL_BITS);
+    world.chopper_px = (int16_t)(chopper_world_x >> SUBPIXEL_BITS);
+    world.scroll_px = (int16_t)(-camera_x >> SUBPIXEL_BITS);
+    world.camera_x16 = WORLD_X16(camera_x);
+    world.chopper_x16 = WORLD_X16(chopper_world_x);
+
+    // Closest base to the chopper (destroyed ones count too: their tanks
+    // still patrol). Ties go to the lower index, as before.
+    uint16_t min_dist = 0xFFFF;
+
+    for (uint8_t i = 0; i < NUM_ENEMY_BASES; i++) {
+        int16_t d = world.chopper_px - base_px[i];
+        uint16_t dist = (d < 0) ? -d : d;
+        if (dist < min_dist) {
+            min_dist = dist;
+            world.closest_base = i;
+        }
+    }
+
+    update_structures_in_view();
+}
@@ -0,0 +1,107 @@
+#ifndef WORLD_H
+#define WORLD_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "constants.h"
+
+// ============================================================================
+// PER-FRAME WORLD QUERIES
+// ============================================================================
+// Things several modules used to work out for themselves, from 32-bit world
+// coordinates, every frame (or every tank): which enemy base is closest,
+// which one is on screen, where the camera is. update_world_view() fills
+// them in once per frame, right after update_chopper_state() has moved the
+// chopper and the camera, and everything later in the frame reads `world`.
+//
+// Positions here are whole pixels in 16 bits. They are for decisions
+// (culling, AI), not for placing sprites: a sprite's screen X must still be
+// (world_x - camera_x) >> SUBPIXEL_BITS so it doesn't jitter against the
+// ground by a pixel when the camera sits between pixels.
+
+// A scroll_px no camera position gives: "never drawn" for the static
+// structures that only redraw when world.scroll_px changes
+#define WORLD_NOT_DRAWN 0x7FFF
+
+// ----------------------------------------------------------------------------
+// 16-bit world X
+// ----------------------------------------------------------------------------
+// The world is 4096px wide and 4096 << SUBPIXEL_BITS is exactly 65536, so a
+// world X in subpixels fits a uint16_t. The entities that live around the
+// camera (tanks, hostages, tank bullets, small explosions) keep their X that
+// way and do their per-frame maths in 16 bits; 32-bit positions only come
+// in when they spawn and go out when they hand off to a 32-bit module (big
+// explosions).
+//
+// Treat a WorldX16 as modulo 65536: compare two of them through
+// WORLD_DX16(), which is exact while they are less than 2048px apart (always
+// true for anything on or near the screen). Plain < and > are only safe
+// between positions known to be inside the world, e.g. the hostage crowd.
+
+typedef uint16_t WorldX16;
+
+#define WORLD_X16(world_x)  ((WorldX16)(world_x))                           // From 32-bit
+#define WORLD_DX16(a, b)    ((int16_t)((WorldX16)(a) - (WorldX16)(b)))      // a - b, subpixels
+#define SCREEN_PX16(x)      (WORLD_DX16((x), world.camera_x16) >> SUBPIXEL_BITS)
+
+_Static_assert((WORLD_WIDTH_PX << SUBPIXEL_BITS) == 0x10000L,
+               "WorldX16 assumes the world is exactly 64K subpixels wide");
+
+// ----------------------------------------------------------------------------
+// Static structure index
+// ----------------------------------------------------------------------------
+// Every building that never moves (enemy bases, the landing pad, the home
+// base) is listed once in world_structures[], sorted by left edge. Each
+// frame update_world_view() slides a window along that list with the camera
+// and leaves world.in_view[] holding exactly the structures overlapping the
+// screen, so renderers only visit what can be seen however many structures
+// the world has. A normal frame moves the window by zero or one entry.
+
+typedef enum {
+    STRUCT_ENEMY_BASE = 0,      // index = enemy base number
+    STRUCT_LANDING_PAD,
+    STRUCT_HOMEBASE             // Flag included
+} StructureKind;
+
+typedef struct {
+    int16_t x_px;               // Left edge, world pixels
+    uint8_t width_px;
+    uint8_t kind;               // StructureKind
+    uint8_t index;              // Which one of its kind
+} Structure;
+
+#define WORLD_MAX_STRUCTURES 8
+#define WORLD_MAX_IN_VIEW    4
+
+extern Structure world_structures[];    // Sorted by x_px
+extern uint8_t world_structure_count;
+
+typedef struct {
+    int16_t camera_px;          // Left edge of the screen (camera_x in pixels)
+    int16_t chopper_px;         // chopper_world_x in pixels
+    int16_t scroll_px;          // Screen X of world pixel 0, see below
+    WorldX16 camera_x16;        // camera_x, 16-bit
+    WorldX16 chopper_x16;       // chopper_world_x, 16-bit
+    uint8_t closest_base;       // Enemy base nearest the chopper
+    uint8_t in_view[WORLD_MAX_IN_VIEW]; // world_structures[] on screen, left to right
+    uint8_t in_view_count;
+} WorldView;
+
+extern WorldView world;
+
+// scroll_px is (0 - camera_x) >> SUBPIXEL_BITS, so anything sitting on a
+// whole world pixel is on screen at world_px + scroll_px, exactly where
+// (world_x - camera_x) >> SUBPIXEL_BITS puts it. The static structures
+// (landing pad, home base, flag, enemy bases) remember the scroll_px they
+// were drawn for and skip the frame when it hasn't changed, so they cost
+// nothing while the chopper sits still or hovers.
+
+extern void init_world_view(void);
+extern void update_world_view(void);
+
+// Standard culling window: a sprite `width` pixels wide at screen_px shows
+// if any of it can be on screen (with the same slack on the right)
+#define ON_SCREEN(screen_px, width) \
+    ((screen_px) > -(width) && (screen_px) < SCREEN_WIDTH + (width))
+
+#endif // WORLD_H
@@ -0,0 +1,350 @@
+#!/usr/bin/env python3
+#
+# Constant tables for RPMegaChopper, worked out at build time.
+#
+# Values the game used to recompute on the 6502 every time it needed them
+# are listed once here and emitted as const data:
+#   luts.h   MusicNote (PSG frequency register values, not Hz), PSG_HZ(),
+#            the sprite pointer tables' extern declarations and frame
+#            counts, the tank aim vectors, the tank metasprite frames, the
+#            animation clips and the terrain map
+#   luts.c   the tables themselves
+#
+# Sprite pointer tables hold one XRAM address per animation frame (and per
+# part, for sprites drawn as two halves). The frame count comes from the
+# region size in xram_layout.py, so growing a sprite there grows its table.
+# Entries are written as REGION + offset so they follow the layout header.
+#
+# Re-run by cmake at configure time, like xram_layout.py.
+
+import argparse
+import os
+import random
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import xram_config
+import xram_layout
+
+# The PSG takes its frequency as Hz * 3
+PSG_FREQ_SCALE = 3
+
+# Music notes in Hz. These are the values the tunes were written against
+# (a few differ from equal temperament by 1Hz), so keep them as they are.
+NOTES = [
+    ("C2", 65), ("CS2", 69), ("D2", 73), ("DS2", 78), ("E2", 82), ("F2", 87),
+    ("FS2", 93), ("G2", 98), ("GS2", 104), ("A2", 110), ("AS2", 117), ("B2", 123),
+    ("C3", 131), ("CS3", 139), ("D3", 147), ("DS3", 156), ("E3", 165), ("F3", 175),
+    ("FS3", 185), ("G3", 196), ("GS3", 208), ("A3", 220), ("AS3", 233), ("B3", 247),
+    ("C4", 262), ("CS4", 277), ("D4", 294), ("DS4", 311), ("E4", 330), ("F4", 349),
+    ("FS4", 370), ("G4", 392), ("GS4", 415), ("A4", 440), ("AS4", 466), ("B4", 494),
+    ("C5", 523), ("CS5", 554), ("D5", 587), ("DS5", 622), ("E5", 659), ("F5", 698),
+    ("FS5", 740), ("G5", 784), ("GS5", 831), ("A5", 880), ("AS5", 932), ("B5", 988),
+    ("C6", 1047), ("CS6", 1109), ("D6", 1175), ("DS6", 1245), ("E6", 1319), ("F6", 1397),
+    ("FS6", 1480), ("G6", 1568), ("GS6", 1661), ("A6", 1760),
+]
+
+# (table, frame count macro, region, bytes per part, parts per frame, comment)
+SPRITE_TABLES = [
+    ("CHOPPER_SPRITE_PTR",   "CHOPPER_SPRITE_FRAMES",   "CHOPPER_DATA",         512,  2, "[frame][0 = left, 1 = right], 16x16 halves"),
+    ("BALLOON_SPRITE_PTR",   "BALLOON_SPRITE_FRAMES",   "BALLOON_DATA",         512,  2, "[frame][0 = bottom, 1 = top], 16x16 halves"),
+    ("EXPLOSION_SPRITE_PTR", "EXPLOSION_SPRITE_FRAMES", "EXPLOSION_DATA",       512,  2, "[frame][0 = left, 1 = right], 16x16 halves"),
+    ("JET_SPRITE_PTR",       "JET_SPRITE_FRAMES",       "JET_DATA",             128,  1, "[frame], 8x8"),
+]
+
+# Tank shot directions, one per aim bin in ebullets.c: 2px/frame at 90, 70,
+# 45, 24 and 9 degrees, X in 12.4 and Y in 8.8 (negative is up). Shots fly
+# TANK_AIM_SCALE times that; the table is emitted already multiplied.
+TANK_AIM = [(0, -512), (11, -480), (23, -368), (29, -208), (32, -80)]
+TANK_AIM_SCALE = 3
+
+# Terrain: the mountain row of the ground plane along the whole world.
+# The plane scrolls at camera_x >> TERRAIN_PARALLAX_SHIFT, so from one end
+# of the world to the other it shows TERRAIN_COLUMNS tile columns. Each
+# column is one tile: 0 (sky, flat ground) or a ridge piece 2-9. The ridge
+# pieces are cut from one continuous skyline, so runs of consecutive
+# pieces read as hills. src/terrain.c streams columns into the XRAM ring
+# as they scroll into view.
+WORLD_WIDTH_PX = 4096           # Must match constants.h
+SCREEN_WIDTH = 320
+TILE_PX = 16
+TERRAIN_PARALLAX_SHIFT = 1
+TERRAIN_COLUMNS = (((WORLD_WIDTH_PX - SCREEN_WIDTH) >> TERRAIN_PARALLAX_SHIFT)
+                   // TILE_PX + SCREEN_WIDTH // TILE_PX + 1)
+RIDGE_FIRST, RIDGE_PIECES = 2, 8
+
+# Tank metasprite (see src/metasprite.h). Tank.bin is 8x8 tiles: two tread
+# frames of 5 body tiles, then 4 turret tiles for each TurretDir (up-left,
+# up, right). Every tread/turret combination becomes one frame, indexed
+# tread * TANK_META_TURRETS + turret, with the turret row 4px in and 8px up.
+# Tiles with no opaque pixels are left out of the frame, so art with empty
+# corners needs fewer sprites.
+TANK_TILE_BYTES = 128
+TANK_BODY_TILES = 5
+TANK_BODY_FRAMES = [0, 5]           # First tile of each tread frame
+TANK_TURRET_TILES = 4
+TANK_TURRETS = [10, 14, 18]         # First tile of each TurretDir
+PIXEL_OPAQUE = 0x0020               # Alpha bit of a 16bpp sprite pixel
+
+# Animation clips (see src/anim.h):
+#   (name, region, bytes per frame, frames, ticks per frame, loop)
+# With a region, each cell is that frame's XRAM pointer (REGION + offset).
+# With None, cells are the frame numbers themselves, for sprites drawn
+# from a table of their own. Ticks is one number for every frame or a
+# list with one per frame.
+ANIM_CLIPS = [
+    ("ANIM_HOSTAGE_RUN_RIGHT", "HOSTAGES_DATA",        512, [0, 1, 2], 7,  True),
+    ("ANIM_HOSTAGE_RUN_LEFT",  "HOSTAGES_DATA",        512, [3, 4, 5], 7,  True),
+    ("ANIM_HOSTAGE_IDLE",      "HOSTAGES_DATA",        512, [8, 9],    7,  True),
+    ("ANIM_HOSTAGE_WAVE",      "HOSTAGES_DATA",        512, [8, 9],    10, True),
+    ("ANIM_SMALL_EXPLOSION",   "SMALL_EXPLOSION_DATA", 128, list(range(7)), 4, False),
+    ("ANIM_FLAG",              "FLAGS_DATA",           512, [0, 1],    11, True),
+    ("ANIM_BALLOON_FLOAT",     None, 0, [0, 1, 2], 9, True),    # BALLOON_SPRITE_PTR
+    ("ANIM_BALLOON_FALL",      None, 0, [0, 1, 2], 3, True),
+    ("ANIM_CHOPPER_BLADES",    None, 0, [0, 1],    3, True),    # Added to base_frame
+    ("ANIM_TANK_TREADS",       None, 0, [0, len(TANK_TURRETS)], 9, True),  # TANK_META
+]
+
+# (world px where the stretch starts, style), one per camp: the enemy
+# bases sit at 200, 1200, 2200 and 3200 (enemybase.c), home at 3972
+TERRAIN_STRETCHES = [
+    (0,    "ridge"),
+    (700,  "foothills"),
+    (1700, "ridge"),
+    (2700, "foothills"),
+    (3550, "plain"),
+]
+
+
+def fail(msg):
+    sys.exit("luts: " + msg)
+
+
+def sprite_frames(regions, region, part_size, parts):
+    size = xram_layout.region(regions, region)["size"]
+    frame_size = part_size * parts
+    if size % frame_size:
+        fail("%s: 0x%X bytes is not a whole number of %d-byte frames"
+             % (region, size, frame_size))
+    return size // frame_size
+
+
+def column_world_x(c):
+    # World X at the middle of the screen when column c is there
+    return ((c * TILE_PX + TILE_PX // 2) << TERRAIN_PARALLAX_SHIFT) - SCREEN_WIDTH // 2
+
+
+def terrain():
+    styles = []
+    for c in range(TERRAIN_COLUMNS):
+        style = TERRAIN_STRETCHES[0][1]
+        for start, s in TERRAIN_STRETCHES:
+            if column_world_x(c) >= start:
+                style = s
+        styles.append(style)
+
+    rng = random.Random(6502)   # Fixed, so every build has the same world
+    tiles = []
+    run = 0         # Ridge pieces left in the current foothill
+    piece = 0
+    for c, style in enumerate(styles):
+        if style == "ridge":
+            tiles.append(RIDGE_FIRST + c % RIDGE_PIECES)
+        elif style == "foothills":
+            if run == 0 and rng.random() < 0.4:
+                run = rng.randint(3, 6)
+                piece = rng.randrange(RIDGE_PIECES)
+            if run:
+                tiles.append(RIDGE_FIRST + piece % RIDGE_PIECES)
+                piece += 1
+                run -= 1
+            else:
+                tiles.append(0)
+        else:
+            tiles.append(0)
+    return tiles
+
+
+def tile_is_blank(image, tile):
+    data = image[tile * TANK_TILE_BYTES:(tile + 1) * TANK_TILE_BYTES]
+    return not any(data[i] & PIXEL_OPAQUE for i in range(0, len(data), 2))
+
+
+def tank_frames(regions):
+    """List of frames, each a list of (tile, dx, dy) parts."""
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    image_name = xram_layout.region(regions, "TANK_DATA")["image"]
+    with open(os.path.join(root, image_name), "rb") as f:
+        image = f.read()
+
+    frames = []
+    for body in TANK_BODY_FRAMES:
+        for turret in TANK_TURRETS:
+            parts = [(body + i, i * 8, 0) for i in range(TANK_BODY_TILES)]
+            parts += [(turret + i, 4 + i * 8, -8) for i in range(TANK_TURRET_TILES)]
+            frames.append([p for p in parts if not tile_is_blank(image, p[0])])
+    return frames
+
+
+def anim_clips(regions):
+    """List of (name, cells, ticks, loop), cells as C expressions."""
+    clips = []
+    for name, region, frame_size, frames, ticks, loop in ANIM_CLIPS:
+        if isinstance(ticks, int):
+            ticks = [ticks] * len(frames)
+        if len(ticks) != len(frames) or not all(0 < t < 256 for t in ticks):
+            fail("%s: need one tick count (1-255) per frame" % name)
+        if region:
+            size = xram_layout.region(regions, region)["size"]
+            if (max(frames) + 1) * frame_size > size:
+                fail("%s: frame %d is past the end of %s" % (name, max(frames), region))
+            cells = ["%s + 0x%04X" % (region, f * frame_size) for f in frames]
+        else:
+            cells = ["%d" % f for f in frames]
+        clips.append((name, cells, ticks, loop))
+    return clips
+
+
+def write_header(path, regions):
+    out = []
+    out.append("// Generated by tools/luts.py -- do not edit.")
+    out.append("#ifndef LUTS_H")
+    out.append("#define LUTS_H")
+    out.append("")
+    out.append("#include <stdint.h>")
+    out.append('#include "metasprite.h"')
+    out.append('#include "anim.h"')
+    out.append("")
+    out.append("// PSG frequency register value for a frequency in Hz")
+    out.append("#define PSG_FREQ_SCALE %d" % PSG_FREQ_SCALE)
+    out.append("#define PSG_HZ(hz) ((uint16_t)((hz) * PSG_FREQ_SCALE))")
+    out.append("")
+    out.append("// Music notes, as PSG frequency register values (0 = rest)")
+    out.append("typedef enum {")
+    out.append("    NOTE_REST = 0,")
+    for i, (name, hz) in enumerate(NOTES):
+        sep = "," if i + 1 < len(NOTES) else ""
+        out.append("    %-9s = %d%s%s// %d Hz"
+                   % ("NOTE_" + name, hz * PSG_FREQ_SCALE, sep,
+                      " " * (6 - len(str(hz * PSG_FREQ_SCALE)) - len(sep)), hz))
+    out.append("} MusicNote;")
+    out.append("")
+    out.append("// Sprite data XRAM pointers")
+    for table, count, region, part_size, parts, comment in SPRITE_TABLES:
+        frames = sprite_frames(regions, region, part_size, parts)
+        out.append("#define %-23s %d" % (count, frames))
+        if parts > 1:
+            out.append("extern const uint16_t %s[%s][%d];  // %s"
+                       % (table, count, parts, comment))
+        else:
+            out.append("extern const uint16_t %s[%s];  // %s" % (table, count, comment))
+    out.append("")
+    out.append("// Tank shot velocity per aim bin, already scaled (x 12.4, y 8.8)")
+    out.append("#define TANK_AIM_BINS %d" % len(TANK_AIM))
+    out.append("extern const int16_t TANK_AIM_VX[TANK_AIM_BINS];")
+    out.append("extern const int16_t TANK_AIM_VY[TANK_AIM_BINS];")
+    out.append("")
+    frames = tank_frames(regions)
+    out.append("// Tank metasprite, frame = tread * TANK_META_TURRETS + TurretDir")
+    out.append("#define TANK_META_TURRETS   %d" % len(TANK_TURRETS))
+    out.append("#define TANK_META_FRAMES    %d" % len(frames))
+    out.append("#define TANK_META_MAX_PARTS %d  // Sprites one tank needs" % max(len(f) for f in frames))
+    out.append("extern const MetaFrame TANK_META[TANK_META_FRAMES];")
+    out.append("")
+    out.append("// Animation clips (see anim.h)")
+    for name, cells, ticks, loop in anim_clips(regions):
+        out.append("extern const AnimClip %s;" % name)
+    out.append("")
+    out.append("// Terrain: mountain-row tile per ground plane column (see terrain.h)")
+    out.append("#define TERRAIN_COLUMNS        %d" % TERRAIN_COLUMNS)
+    out.append("#define TERRAIN_PARALLAX_SHIFT %d" % TERRAIN_PARALLAX_SHIFT)
+    out.append("#define TERRAIN_RING_COLUMNS   %d  // GROUND_MAP width" % xram_config.GROUND_MAP_WIDTH)
+    out.append("#define TERRAIN_ROW            %d" % xram_config.TERRAIN_ROW)
+    out.append("extern const uint8_t TERRAIN_TILES[TERRAIN_COLUMNS];")
+    out.append("")
+    out.append("#endif // LUTS_H")
+    with open(path, "w") as f:
+        f.write("\n".join(out) + "\n")
+
+
+def write_source(path, regions):
+    out = []
+    out.append("// Generated by tools/luts.py -- do not edit.")
+    out.append("#include <stdint.h>")
+    out.append("#include <stdbool.h>")
+    out.append('#include "xram_layout.h"')
+    out.append('#include "luts.h"')
+    for table, count, region, part_size, parts, comment in SPRITE_TABLES:
+        frames = sprite_frames(regions, region, part_size, parts)
+        out.append("")
+        if parts > 1:
+            out.append("const uint16_t %s[%s][%d] = {" % (table, count, parts))
+            for f in range(frames):
+                cells = ", ".join("%s + 0x%04X" % (region, (f * parts + p) * part_size)
+                                  for p in range(parts))
+                out.append("    { %s }," % cells)
+        else:
+            out.append("const uint16_t %s[%s] = {" % (table, count))
+            for f in range(frames):
+                out.append("    %s + 0x%04X," % (region, f * part_size))
+        out.append("};")
+    out.append("")
+    out.append("const int16_t TANK_AIM_VX[TANK_AIM_BINS] = { %s };"
+               % ", ".join(str(vx * TANK_AIM_SCALE) for vx, vy in TANK_AIM))
+    out.append("const int16_t TANK_AIM_VY[TANK_AIM_BINS] = { %s };"
+               % ", ".join(str(vy * TANK_AIM_SCALE) for vx, vy in TANK_AIM))
+    out.append("")
+    frames = tank_frames(regions)
+    out.append("static const MetaPart TANK_META_PARTS[] = {")
+    for n, frame in enumerate(frames):
+        out.append("    // Frame %d" % n)
+        for tile, dx, dy in frame:
+            out.append("    { %d, %d, TANK_DATA + 0x%04X }," % (dx, dy, tile * TANK_TILE_BYTES))
+    out.append("};")
+    out.append("")
+    out.append("const MetaFrame TANK_META[TANK_META_FRAMES] = {")
+    first = 0
+    for frame in frames:
+        out.append("    { %d, &TANK_META_PARTS[%d] }," % (len(frame), first))
+        first += len(frame)
+    out.append("};")
+    out.append("")
+    for name, cells, ticks, loop in anim_clips(regions):
+        out.append("static const uint16_t %s_CELLS[] = { %s };" % (name, ", ".join(cells)))
+        out.append("static const uint8_t %s_TICKS[] = { %s };"
+                   % (name, ", ".join(str(t) for t in ticks)))
+        out.append("const AnimClip %s = { %d, %s, %s_CELLS, %s_TICKS };"
+                   % (name, len(cells), "true" if loop else "false", name, name))
+        out.append("")
+    tiles = terrain()
+    out.append("const uint8_t TERRAIN_TILES[TERRAIN_COLUMNS] = {")
+    for i in range(0, len(tiles), 16):
+        out.append("    " + ", ".join("%d" % t for t in tiles[i:i + 16]) + ",")
+    out.append("};")
+    with open(path, "w") as f:
+        f.write("\n".join(out) + "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate the constant tables")
+    parser.add_argument("--header", required=True, help="output luts.h")
+    parser.add_argument("--source", required=True, help="output luts.c")
+    args = parser.parse_args()
+
+    regions, _, _ = xram_layout.build()
+    tiles = xram_layout.region(regions, "TANK_DATA")["size"] // TANK_TILE_BYTES
+    if (max(TANK_BODY_FRAMES) + TANK_BODY_TILES > tiles
+            or max(TANK_TURRETS) + TANK_TURRET_TILES > tiles):
+        fail("tank frames run past the %d tiles in TANK_DATA" % tiles)
+    ring = xram_config.GROUND_MAP_WIDTH
+    if ring & (ring - 1) or ring * TILE_PX < SCREEN_WIDTH + TILE_PX:
+        fail("GROUND_MAP_WIDTH must be a power of two wider than the screen")
+    for name, hz in NOTES:
+        if hz * PSG_FREQ_SCALE > 0xFFFF:
+            fail("NOTE_%s does not fit the 16-bit PSG frequency" % name)
+    write_header(args.header, regions)
+    write_source(args.source, regions)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+#
+# Build the initial XRAM plane configuration for RPMegaChopper.
+#
+# Emits one binary covering, in XRAM order:
+#   GROUND_MAP    32x15 tile ring (sky, mountain row, solid ground), padded
+#                 to GROUND_MAP_SIZE. The mountain row starts as sky;
+#                 src/terrain.c streams the real terrain into it.
+#   GROUND_CONFIG vga_mode2_config_t for the ground plane
+#   TEXT_CONFIG   vga_mode1_config_t for the HUD text plane
+#   text buffer   MESSAGE_LENGTH cells of (char, fg, bg), cleared to spaces
+#
+# The result is packed with rp6502_asset() so the ROM loader drops it
+# straight into XRAM and init_graphics() only has to issue the xregn enables.
+# Addresses and sizes come from xram_layout.py.
+
+import argparse
+import os
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import xram_layout
+
+# The ground plane is a ring of GROUND_MAP_WIDTH tile columns that wraps
+# horizontally. It has to be wider than the 21 columns one screen can
+# touch; a power of two lets terrain.c mask instead of divide.
+GROUND_MAP_WIDTH = 32
+GROUND_MAP_HEIGHT = 15
+TERRAIN_ROW = 11            # The only row that varies along the world
+
+# --- Must match hud.h ---
+MESSAGE_WIDTH = 40
+MESSAGE_HEIGHT = 15
+MESSAGE_LENGTH = MESSAGE_WIDTH * MESSAGE_HEIGHT + 1
+HUD_COL_WHITE = 15
+HUD_COL_BG = 0
+
+def ground_map():
+    tiles = bytearray()
+    for y in range(GROUND_MAP_HEIGHT):
+        for x in range(GROUND_MAP_WIDTH):
+            if y > TERRAIN_ROW:
+                tiles.append(1)             # Solid Ground
+            else:
+                tiles.append(0)             # Sky (mountains streamed in later)
+    return tiles
+
+
+def plane_config(x_wrap, y_wrap, x, y, width, height, data, palette, tiles):
+    # bool, bool, int16 x4, uint16 x3 -- little endian like the 6502
+    return struct.pack("<BBhhhhHHH", x_wrap, y_wrap, x, y, width, height,
+                       data, palette, tiles)
+
+
+def build(regions):
+    def at(name):
+        return xram_layout.region(regions, name)
+
+    base = at("GROUND_MAP_START")["addr"]
+    blob = bytearray()
+
+    blob += ground_map()
+    blob += bytes(at("GROUND_MAP_START")["size"] - len(blob))
+
+    assert base + len(blob) == at("GROUND_CONFIG")["addr"]
+    blob += plane_config(1, 1, 0, 0, GROUND_MAP_WIDTH, GROUND_MAP_HEIGHT,
+                         base, at("PALETTE_ADDR")["addr"], at("GROUND_DATA")["addr"])
+
+    assert base + len(blob) == at("TEXT_CONFIG")["addr"]
+    # x_pos_px must be zero or the first char is duplicated
+    blob += plane_config(0, 0, 0, 5, MESSAGE_WIDTH, MESSAGE_HEIGHT,
+                         at("TEXT_MESSAGE_ADDR")["addr"], 0xFFFF, 0xFFFF)
+
+    assert base + len(blob) == at("TEXT_MESSAGE_ADDR")["addr"]
+    blob += bytes((ord(" "), HUD_COL_WHITE, HUD_COL_BG)) * MESSAGE_LENGTH
+
+    text = at("TEXT_MESSAGE_ADDR")
+    assert base + len(blob) == text["addr"] + text["size"]
+    return blob
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Build the XRAM plane config blob")
+    parser.add_argument("-o", "--output", required=True, help="output .bin")
+    args = parser.parse_args()
+
+    # Overlap and ceiling checks happen in xram_layout.build()
+    regions, _, _ = xram_layout.build()
+    blob = build(regions)
+
+    with open(args.output, "wb") as f:
+        f.write(blob)
+
+
+if __name__ == "__main__":
+    main()
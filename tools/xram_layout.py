@@ -0,0 +1,218 @@
+#!/usr/bin/env python3
+#
+# Single description of the RPMegaChopper XRAM map.
+#
+# Everything that lives in XRAM is listed once in LAYOUT below. Packed
+# regions are laid out back to back from 0x0000 in list order; fixed
+# regions (palette, input, PSG) sit where the firmware expects them.
+#
+# From this table we generate:
+#   xram_layout.h      #defines for every address/size, _Static_asserts
+#                      for overlap and the fixed-region ceiling, and an
+#                      X-macro used by init_graphics() to dump the map
+#   xram_layout.cmake  the rp6502_asset() load address of every image
+#
+# The script refuses to generate anything if two regions overlap, if a
+# packed region runs into the fixed block, or if an image file is larger
+# than the region reserved for it. Free XRAM is reported on every run.
+#
+# To add animation frames: grow the *_SIZE of the sprite (or add a new
+# entry) and re-run cmake. Every address after it moves automatically.
+
+import argparse
+import os
+import sys
+
+XRAM_SIZE = 0x10000
+
+SPRITE_CONFIG_RECORDS = 89      # Must equal SPRITE_COUNT (checked in sprites.c)
+SPRITE_CONFIG_RECORD_SIZE = 8   # sizeof(vga_mode4_sprite_t)
+PLANE_CONFIG_SIZE = 16          # sizeof(vga_mode1/2_config_t)
+MESSAGE_LENGTH = 40 * 15 + 1    # Must match hud.h
+GAMEPAD_COUNT = 4
+GAMEPAD_DATA_SIZE = 10
+
+# (address macro, size macro, size, image file, label)
+#
+# Packed regions, in XRAM order. An image of None means the region is
+# filled at runtime or by xram_config.py.
+LAYOUT = [
+    ("CHOPPER_DATA",         "CHOPPER_DATA_SIZE",         0x5800, "images/Chopper.bin",      "Chopper"),
+    ("GROUND_DATA",          "GROUND_DATA_SIZE",          0x0500, "images/Tiles_Ground.bin", "Ground Tiles"),
+    ("CLOUD_A_DATA",         "CLOUD_A_DATA_SIZE",         0x0800, "images/Cloud_A.bin",      "Cloud A"),
+    ("CLOUD_B_DATA",         "CLOUD_B_DATA_SIZE",         0x0800, "images/Cloud_B.bin",      "Cloud B"),
+    ("CLOUD_C_DATA",         "CLOUD_C_DATA_SIZE",         0x0200, "images/Cloud_C.bin",      "Cloud C"),
+    ("LANDINGPAD_DATA",      "LANDINGPAD_DATA_SIZE",      0x1200, "images/LandingPad.bin",   "Landing Pad"),
+    ("HOMEBASE_DATA",        "HOMEBASE_DATA_SIZE",        0x0C00, "images/HomeBase.bin",     "Homebase"),
+    ("ENEMYBASE_DATA",       "ENEMYBASE_DATA_SIZE",       0x1800, "images/EnemyBase.bin",    "Enemybase"),
+    ("FLAGS_DATA",           "FLAGS_DATA_SIZE",           0x0400, "images/Flags.bin",        "Flags"),
+    ("HOSTAGES_DATA",        "HOSTAGES_DATA_SIZE",        0x1400, "images/Hostages.bin",     "Hostages"),
+    ("BULLET_DATA",          "BULLET_DATA_SIZE",          0x0008, "images/bullet.bin",       "Bullet"),
+    ("EXPLOSION_DATA",       "EXPLOSION_DATA_SIZE",       0x1400, "images/Explosion.bin",    "Explosion"),
+    ("SMALL_EXPLOSION_DATA", "SMALL_EXPLOSION_DATA_SIZE", 0x0380, "images/SmallExplode.bin", "Small Explosion"),
+    ("TANK_DATA",            "TANK_DATA_SIZE",            0x0B00, "images/Tank.bin",         "Tank"),
+    ("BOOM_DATA",            "BOOM_DATA_SIZE",            0x0400, "images/Boom.bin",         "Boom"),
+    ("BALLOON_DATA",         "BALLOON_DATA_SIZE",         0x0C00, "images/Balloon.bin",      "Balloon"),
+    ("JET_DATA",             "JET_DATA_SIZE",             0x0200, "images/Jet.bin",          "Jet"),
+    ("BOMB_DATA",            "BOMB_DATA_SIZE",            0x0080, "images/Bomb.bin",         "Bomb"),
+    ("MINICHOPPER_DATA",     "MINICHOPPER_DATA_SIZE",     0x0080, "images/Minichopper.bin",  "Mini Chopper"),
+    ("SPRITE_CONFIG_BASE",   "SPRITE_CONFIG_SIZE",
+        SPRITE_CONFIG_RECORDS * SPRITE_CONFIG_RECORD_SIZE, None, "Sprite Config Records"),
+    # xram_config.py fills GROUND_MAP_START .. TEXT_STORAGE_END in one asset
+    ("GROUND_MAP_START",     "GROUND_MAP_SIZE",           0x01E0, None, "Ground Map"),
+    ("GROUND_CONFIG",        "GROUND_CONFIG_SIZE",        PLANE_CONFIG_SIZE, None, "Ground Config"),
+    ("TEXT_CONFIG",          "TEXT_CONFIG_SIZE",          PLANE_CONFIG_SIZE, None, "Text Config"),
+    ("TEXT_MESSAGE_ADDR",    "TEXT_MESSAGE_SIZE",         MESSAGE_LENGTH * 3, None, "Text Buffer"),
+]
+
+# Fixed regions: (address macro, size macro, address, size, label)
+FIXED = [
+    ("PALETTE_ADDR",   "PALETTE_SIZE",        0xFF58, 16 * 2,                          "Palette"),
+    ("GAMEPAD_INPUT",  "GAMEPAD_INPUT_SIZE",  0xFF78, GAMEPAD_COUNT * GAMEPAD_DATA_SIZE, "Gamepads"),
+    ("KEYBOARD_INPUT", "KEYBOARD_INPUT_SIZE", 0xFFA0, 32,                              "Keyboard"),
+    ("PSG_XRAM_ADDR",  "PSG_XRAM_SIZE",       0xFFC0, 8 * 8,                           "PSG"),
+]
+
+# Extra markers emitted alongside the regions: name -> region whose end it is
+END_MARKERS = {
+    "SPRITE_DATA_END": "MINICHOPPER_DATA",
+    "GROUND_MAP_END": "GROUND_MAP_START",
+    "TEXT_STORAGE_END": "TEXT_MESSAGE_ADDR",
+}
+
+
+def fail(msg):
+    sys.exit("xram_layout: " + msg)
+
+
+def build(root=None):
+    """Return (regions, free_start, free_size).
+
+    regions is a list of dicts in XRAM order with name, size_name, addr,
+    size, image and label. Image sizes are only checked when root is given.
+    """
+    regions = []
+    addr = 0
+    for name, size_name, size, image, label in LAYOUT:
+        if image and root:
+            path = os.path.join(root, image)
+            if not os.path.exists(path):
+                fail("%s: missing %s" % (name, image))
+            actual = os.path.getsize(path)
+            if actual > size:
+                fail("%s: %s is 0x%X bytes, only 0x%X reserved"
+                     % (name, image, actual, size))
+        regions.append(dict(name=name, size_name=size_name, addr=addr,
+                            size=size, image=image, label=label))
+        addr += size
+
+    free_start = addr
+    for name, size_name, faddr, size, label in FIXED:
+        regions.append(dict(name=name, size_name=size_name, addr=faddr,
+                            size=size, image=None, label=label))
+
+    ordered = sorted(regions, key=lambda r: r["addr"])
+    for a, b in zip(ordered, ordered[1:]):
+        if a["addr"] + a["size"] > b["addr"]:
+            fail("%s (0x%04X-0x%04X) overlaps %s at 0x%04X"
+                 % (a["name"], a["addr"], a["addr"] + a["size"] - 1,
+                    b["name"], b["addr"]))
+    last = ordered[-1]
+    if last["addr"] + last["size"] > XRAM_SIZE:
+        fail("%s runs past the end of XRAM" % last["name"])
+
+    free_size = FIXED[0][2] - free_start
+    return regions, free_start, free_size
+
+
+def region(regions, name):
+    for r in regions:
+        if r["name"] == name:
+            return r
+    raise KeyError(name)
+
+
+def write_header(path, regions, free_start, free_size):
+    out = []
+    out.append("// Generated by tools/xram_layout.py -- do not edit.")
+    out.append("// Change the LAYOUT table in the script instead.")
+    out.append("#ifndef XRAM_LAYOUT_H")
+    out.append("#define XRAM_LAYOUT_H")
+    out.append("")
+    out.append("#define SPRITE_DATA_START       0x0000U")
+    out.append("#define SPRITE_CONFIG_RECORDS   %d" % SPRITE_CONFIG_RECORDS)
+    out.append("")
+    for r in regions:
+        out.append("#define %-26s 0x%04XU  // %s" % (r["name"], r["addr"], r["label"]))
+        out.append("#define %-26s 0x%04XU" % (r["size_name"], r["size"]))
+    out.append("")
+    for marker, name in END_MARKERS.items():
+        out.append("#define %-26s (%s + %s)" % (marker, name, region(regions, name)["size_name"]))
+    out.append("")
+    out.append("// Unused XRAM between the packed data and the fixed block")
+    out.append("#define %-26s 0x%04XU" % ("XRAM_FREE_START", free_start))
+    out.append("#define %-26s 0x%04XU  // %d bytes" % ("XRAM_FREE_SIZE", free_size, free_size))
+    out.append("")
+    out.append("// The script already checked these; they catch hand edits of this file")
+    out.append("#ifdef __cplusplus")
+    out.append("#define XRAM_STATIC_ASSERT static_assert")
+    out.append("#else")
+    out.append("#define XRAM_STATIC_ASSERT _Static_assert")
+    out.append("#endif")
+    ordered = sorted(regions, key=lambda r: r["addr"])
+    for a, b in zip(ordered, ordered[1:]):
+        out.append('XRAM_STATIC_ASSERT(%s + %s <= %s, "XRAM: %s overlaps %s");'
+                   % (a["name"], a["size_name"], b["name"], a["name"], b["name"]))
+    out.append('XRAM_STATIC_ASSERT(XRAM_FREE_START <= %s, "XRAM: data runs into the fixed block");'
+               % FIXED[0][0])
+    out.append("")
+    out.append("// X(addr, size, label) for every region, in XRAM order")
+    out.append("#define XRAM_LAYOUT_REGIONS(X) \\")
+    for r in ordered:
+        out.append('    X(%s, %s, "%s") \\' % (r["name"], r["size_name"], r["label"]))
+    out.append("")
+    out.append("#endif // XRAM_LAYOUT_H")
+    with open(path, "w") as f:
+        f.write("\n".join(out) + "\n")
+
+
+def write_cmake(path, regions):
+    out = []
+    out.append("# Generated by tools/xram_layout.py -- do not edit.")
+    for r in regions:
+        out.append("set(XRAM_%s 0x%04X)" % (r["name"], r["addr"]))
+    out.append("set(XRAM_ASSETS")
+    for r in regions:
+        if r["image"]:
+            # The ROM loader puts XRAM at 0x10000
+            out.append("    0x%05X %s" % (0x10000 + r["addr"], r["image"]))
+    out.append(")")
+    with open(path, "w") as f:
+        f.write("\n".join(out) + "\n")
+
+
+def report(regions, free_start, free_size):
+    for r in sorted(regions, key=lambda r: r["addr"]):
+        print("  0x%04X-0x%04X %6d  %s"
+              % (r["addr"], r["addr"] + r["size"] - 1, r["size"], r["label"]))
+    print("  XRAM free: %d bytes at 0x%04X" % (free_size, free_start))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate the XRAM layout")
+    parser.add_argument("-r", "--root", required=True,
+                        help="project root (image paths are relative to it)")
+    parser.add_argument("--header", help="output xram_layout.h")
+    parser.add_argument("--cmake", help="output xram_layout.cmake")
+    args = parser.parse_args()
+
+    regions, free_start, free_size = build(args.root)
+    if args.header:
+        write_header(args.header, regions, free_start, free_size)
+    if args.cmake:
+        write_cmake(args.cmake, regions)
+    report(regions, free_start, free_size)
+
+
+if __name__ == "__main__":
+    main()